@@ -0,0 +1,8 @@
+#pragma once
+#include <cstddef>
+
+// Number of calls to the global operator new (and new[]) since startup.
+// alloccount.cpp replaces the global allocation functions to count them,
+// so only link it into the game, where the main loop checks that a frame
+// with nothing new to show allocates nothing.
+size_t HeapAllocations();
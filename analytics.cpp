@@ -0,0 +1,222 @@
+#include "analytics.h"
+#include "bitboard.h"
+#include <algorithm>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ANALYTICS_USE_SSE2
+#endif
+
+static const uint8_t ZERO_MASK = Grid::ADJ_MASK | Grid::MINE_BIT;
+
+// Bit c of word c / 64 is padded column c. Zero cells go into zero and safe
+// non-zero cells into number; the border columns are left out of both.
+static void RowMasks(const uint8_t* row, int cols, int words, uint64_t* zero, uint64_t* number) {
+    memset(zero, 0, (size_t)words * sizeof(uint64_t));
+    memset(number, 0, (size_t)words * sizeof(uint64_t));
+    int c = 1;
+#if defined(ANALYTICS_USE_SSE2)
+    const __m128i zeroMask = _mm_set1_epi8((char)ZERO_MASK);
+    const __m128i mineBit = _mm_set1_epi8((char)Grid::MINE_BIT);
+    const __m128i none = _mm_setzero_si128();
+    for (; c + 16 <= cols + 1; c += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(row + c));
+        uint64_t z = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(v, zeroMask), none));
+        uint64_t safe = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(v, mineBit), none));
+        uint64_t n = safe & ~z;
+        int w = c >> 6, b = c & 63;
+        zero[w] |= z << b;
+        number[w] |= n << b;
+        if (b > 48) {
+            zero[w + 1] |= z >> (64 - b);
+            number[w + 1] |= n >> (64 - b);
+        }
+    }
+#endif
+    for (; c <= cols; c++) {
+        uint64_t bit = 1ULL << (c & 63);
+        if ((row[c] & ZERO_MASK) == 0) zero[c >> 6] |= bit;
+        else if (!(row[c] & Grid::MINE_BIT)) number[c >> 6] |= bit;
+    }
+}
+
+int BoardAnalyzer::Find(int x) {
+    while (parent[x] != x) {
+        parent[x] = parent[parent[x]];
+        x = parent[x];
+    }
+    return x;
+}
+
+// Keeps the root that comes first in raster order, so a parent always has a
+// lower index than its children.
+bool BoardAnalyzer::Union(int a, int b) {
+    a = Find(a);
+    b = Find(b);
+    if (a == b) return false;
+    if (a < b) parent[b] = a;
+    else parent[a] = b;
+    return true;
+}
+
+BoardStats BoardAnalyzer::Analyze(const Grid& grid, std::vector<int>* sizes) {
+    BoardStats stats;
+    int rows = grid.Rows(), cols = grid.Cols(), stride = grid.Stride();
+    int words = (stride + 63) / 64;
+    const uint8_t* cells = grid.Data();
+    zeros.assign((size_t)3 * words, 0);
+    numbers.assign((size_t)3 * words, 0);
+    runs.clear();
+    parent.clear();
+    rowRuns.assign((size_t)rows + 3, 0);
+
+    int merges = 0;
+    RowMasks(cells + stride, cols, words, &zeros[(size_t)words], &numbers[(size_t)words]);
+    for (int pr = 1; pr <= rows; pr++) {
+        uint64_t* next = &zeros[(size_t)((pr + 1) % 3) * words];
+        if (pr < rows) RowMasks(cells + (size_t)(pr + 1) * stride, cols, words, next, &numbers[(size_t)((pr + 1) % 3) * words]);
+        else memset(next, 0, (size_t)words * sizeof(uint64_t));
+        const uint64_t* prev = &zeros[(size_t)((pr - 1) % 3) * words];
+        const uint64_t* cur = &zeros[(size_t)(pr % 3) * words];
+        const uint64_t* num = &numbers[(size_t)(pr % 3) * words];
+
+        for (int w = 0; w < words; w++) {
+            uint64_t x = prev[w] | cur[w] | next[w];
+            uint64_t left = w > 0 ? (prev[w - 1] | cur[w - 1] | next[w - 1]) >> 63 : 0;
+            uint64_t right = w + 1 < words ? (prev[w + 1] | cur[w + 1] | next[w + 1]) << 63 : 0;
+            stats.isolated += PopCount(num[w] & ~(x | x << 1 | x >> 1 | left | right));
+        }
+
+        // Run starts and ends are the bits whose left or right neighbor is
+        // clear. A row has as many of one as of the other and they pair up
+        // in order, so begins and ends are filled in separately.
+        int first = (int)runs.size(), count = 0;
+        for (int w = 0; w < words; w++) count += PopCount(cur[w] & ~(cur[w] << 1 | (w > 0 ? cur[w - 1] >> 63 : 0)));
+        runs.resize((size_t)(first + count));
+        parent.resize((size_t)(first + count));
+        Run* row = runs.data() + first;
+        int b = 0, e = 0;
+        for (int w = 0; w < words; w++) {
+            uint64_t x = cur[w];
+            uint64_t starts = x & ~(x << 1 | (w > 0 ? cur[w - 1] >> 63 : 0));
+            uint64_t ends = x & ~(x >> 1 | (w + 1 < words ? cur[w + 1] << 63 : 0));
+            for (; starts; starts &= starts - 1) row[b++].begin = (w << 6) + LowestBit(starts);
+            for (; ends; ends &= ends - 1) row[e++].end = (w << 6) + LowestBit(ends);
+        }
+        for (int k = first; k < first + count; k++) parent[(size_t)k] = k;
+        rowRuns[(size_t)pr] = first;
+
+        // Runs of the row above overlap or touch a run diagonally when they
+        // come within one column of it; both lists are in column order.
+        int above = rowRuns[(size_t)pr - 1];
+        for (int k = first; k < first + count; k++) {
+            int begin = runs[(size_t)k].begin, end = runs[(size_t)k].end;
+            while (above < first && runs[(size_t)above].end < begin - 1) above++;
+            for (int q = above; q < first && runs[(size_t)q].begin <= end + 1; q++) merges += Union(q, k);
+        }
+    }
+    rowRuns[(size_t)rows + 1] = rowRuns[(size_t)rows + 2] = (int)runs.size();
+    stats.openings = (int)runs.size() - merges;
+    stats.bbbv = stats.openings + stats.isolated;
+
+    if (sizes) {
+        size_t first = sizes->size();
+        OpeningSizes(grid, *sizes);
+        for (size_t i = first; i < sizes->size(); i++) stats.largestOpening = std::max(stats.largestOpening, (*sizes)[i]);
+    }
+    return stats;
+}
+
+// The cells an opening reveals in row r are the dilated runs of that
+// opening in rows r - 1 to r + 1, merged where they overlap. Each row's runs
+// are already sorted, so merging the three lists visits the dilated runs in
+// column order and each opening only needs the end of its last one.
+void BoardAnalyzer::OpeningSizes(const Grid& grid, std::vector<int>& sizes) {
+    int rows = grid.Rows(), cols = grid.Cols();
+    size_t n = runs.size();
+    // Parents come first, so one pass in order flattens every tree.
+    for (size_t q = 0; q < n; q++) parent[q] = parent[(size_t)parent[q]];
+    counts.assign(n, 0);
+    lastEnd.assign(n, 0);
+    lastRow.assign(n, 0);
+    for (int pr = 1; pr <= rows; pr++) {
+        int at[3], stop[3];
+        for (int k = 0; k < 3; k++) {
+            at[k] = rowRuns[(size_t)(pr - 1 + k)];
+            stop[k] = rowRuns[(size_t)(pr + k)];
+        }
+        for (;;) {
+            int pick = -1;
+            for (int k = 0; k < 3; k++)
+                if (at[k] < stop[k] && (pick < 0 || runs[(size_t)at[k]].begin < runs[(size_t)at[pick]].begin)) pick = k;
+            if (pick < 0) break;
+            int q = at[pick]++;
+            int root = parent[(size_t)q];
+            int begin = std::max(runs[(size_t)q].begin - 1, 1), end = std::min(runs[(size_t)q].end + 1, cols);
+            if (lastRow[(size_t)root] == pr && begin <= lastEnd[(size_t)root]) {
+                if (end > lastEnd[(size_t)root]) {
+                    counts[(size_t)root] += end - lastEnd[(size_t)root];
+                    lastEnd[(size_t)root] = end;
+                }
+            } else {
+                counts[(size_t)root] += end - begin + 1;
+                lastEnd[(size_t)root] = end;
+                lastRow[(size_t)root] = pr;
+            }
+        }
+    }
+    for (size_t q = 0; q < n; q++)
+        if (parent[q] == (int)q) sizes.push_back(counts[q]);
+}
+
+void Histogram::Add(int value) {
+    if (value < 0) value = 0;
+    if ((size_t)value >= counts.size()) counts.resize((size_t)value + 1, 0);
+    counts[(size_t)value]++;
+    total++;
+    sum += value;
+}
+
+void Histogram::Merge(const Histogram& other) {
+    if (other.counts.size() > counts.size()) counts.resize(other.counts.size(), 0);
+    for (size_t i = 0; i < other.counts.size(); i++) counts[i] += other.counts[i];
+    total += other.total;
+    sum += other.sum;
+}
+
+int Histogram::Min() const {
+    for (size_t i = 0; i < counts.size(); i++)
+        if (counts[i]) return (int)i;
+    return 0;
+}
+
+int Histogram::Percentile(double p) const {
+    long long need = (long long)(p * (double)total + 0.5), seen = 0;
+    if (need < 1) need = 1;
+    for (size_t i = 0; i < counts.size(); i++) {
+        seen += counts[i];
+        if (seen >= need) return (int)i;
+    }
+    return Max();
+}
+
+void Histogram::Print(FILE* out, const char* title, int maxRows) const {
+    fprintf(out, "%s: n=%lld mean=%.2f min=%d p50=%d p90=%d p99=%d max=%d\n", title, total, Mean(), Min(),
+            Percentile(0.50), Percentile(0.90), Percentile(0.99), Max());
+    if (total == 0) return;
+    int lo = Min(), hi = Max();
+    int width = (hi - lo) / maxRows + 1;
+    std::vector<long long> buckets((size_t)((hi - lo) / width + 1), 0);
+    for (int v = lo; v <= hi; v++) buckets[(size_t)((v - lo) / width)] += counts[(size_t)v];
+    long long peak = *std::max_element(buckets.begin(), buckets.end());
+    const int BAR = 40;
+    for (size_t b = 0; b < buckets.size(); b++) {
+        int from = lo + (int)b * width, to = std::min(from + width - 1, hi);
+        int bar = (int)((buckets[b] * BAR + peak - 1) / peak);
+        if (width == 1) fprintf(out, "  %9d        ", from);
+        else fprintf(out, "  %7d-%-7d  ", from, to);
+        fprintf(out, "%6.2f%% %.*s\n", 100.0 * (double)buckets[b] / (double)total, bar,
+                "########################################");
+    }
+}
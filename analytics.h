@@ -0,0 +1,84 @@
+#pragma once
+#include "grid.h"
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+// Difficulty metrics of a mine layout, independent of cell states.
+struct BoardStats {
+    // Openings: 8-connected groups of zero cells, each revealed by one click.
+    int openings = 0;
+    // Safe numbers with no zero neighbor, each needing a click of its own.
+    int isolated = 0;
+    // Minimum number of left clicks that clears the board.
+    int bbbv = 0;
+    // Cells revealed by the largest opening, its bordering numbers included.
+    // Only set when opening sizes are requested.
+    int largestOpening = 0;
+};
+
+// Computes BoardStats in one pass over the rows, each turned into bitmasks
+// of its zero cells and its numbers (SSE2 where available). A number is
+// isolated when it is outside the zero mask of its own and the two
+// neighboring rows, dilated by a column; that takes a few word operations
+// per 64 cells. Openings come from union-find over runs of zero cells, each
+// joined with the runs it touches in the row above, so the work per row is
+// per run rather than per cell. An opening reveals exactly its zero cells
+// dilated by one (zero cells have no mine neighbors), so opening sizes are
+// the merged dilated runs of every opening, row by row, in a second pass
+// over the runs only. The buffers are kept between calls, so analysing many
+// boards allocates nothing after the largest one.
+class BoardAnalyzer {
+public:
+    // When sizes is given, the size of every opening (zero cells plus the
+    // numbers around them) is appended to it.
+    BoardStats Analyze(const Grid& grid, std::vector<int>* sizes = nullptr);
+
+private:
+    // Zero cells [begin, end] of a padded row.
+    struct Run {
+        int begin;
+        int end;
+    };
+
+    int Find(int x);
+    bool Union(int a, int b);
+    void OpeningSizes(const Grid& grid, std::vector<int>& sizes);
+
+    std::vector<Run> runs;
+    // Runs of padded row r are [rowRuns[r], rowRuns[r + 1]), border rows
+    // included.
+    std::vector<int> rowRuns;
+    // Union-find over runs.
+    std::vector<int> parent;
+    // Zero and number masks of three rows by row number mod 3.
+    std::vector<uint64_t> zeros;
+    std::vector<uint64_t> numbers;
+    // Per root: cells revealed so far, and the row and end column of its
+    // last dilated run.
+    std::vector<int> counts;
+    std::vector<int> lastEnd;
+    std::vector<int> lastRow;
+};
+
+// Counts of non-negative integer values, grown on demand.
+class Histogram {
+public:
+    void Add(int value);
+    void Merge(const Histogram& other);
+
+    long long Total() const { return total; }
+    double Mean() const { return total ? sum / (double)total : 0.0; }
+    int Min() const;
+    int Max() const { return (int)counts.size() - 1; }
+    // The smallest value with at least p of the samples at or below it.
+    int Percentile(double p) const;
+
+    // Summary line and at most maxRows equal-width buckets with bars.
+    void Print(FILE* out, const char* title, int maxRows = 16) const;
+
+private:
+    std::vector<long long> counts;
+    long long total = 0;
+    double sum = 0.0;
+};
@@ -0,0 +1,4089 @@
+// Generated by tools/pack_assets.py from Graphics/; do not edit.
+#include "assets.h"
+
+const SpriteRect SPRITES[SPRITE_COUNT] = {
+    { 65, 0, 44, 44 },  // bomb
+    { 110, 0, 44, 44 },  // exploded bomb
+    { 155, 0, 44, 44 },  // flag
+    { 200, 0, 44, 44 },  // question mark
+    { 0, 65, 40, 40 },  // face
+    { 41, 65, 40, 40 },  // worried face
+    { 82, 65, 40, 40 },  // lost face
+    { 123, 65, 40, 40 },  // won face
+    { 0, 0, 64, 64 },  // icon
+    { 164, 65, 15, 21 },  // digit 1
+    { 180, 65, 15, 21 },  // digit 2
+    { 196, 65, 15, 21 },  // digit 3
+    { 212, 65, 15, 21 },  // digit 4
+    { 228, 65, 15, 21 },  // digit 5
+    { 0, 106, 15, 21 },  // digit 6
+    { 16, 106, 15, 21 },  // digit 7
+    { 32, 106, 15, 21 },  // digit 8
+};
+
+const unsigned char ATLAS_PIXELS[] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,139,0,0,0,244,0,0,0,253,
+    0,0,0,253,0,0,0,250,0,0,0,177,0,0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,1,1,1,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,1,1,1,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,0,0,0,255,13,13,13,255,121,121,121,255,
+    61,61,61,255,0,0,0,255,0,0,0,255,0,0,0,178,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,1,1,1,255,
+    2,2,2,255,4,4,4,255,4,4,4,255,5,5,5,255,9,9,9,255,13,13,13,255,17,17,17,255,19,19,19,255,
+    20,20,20,255,21,21,21,255,22,22,22,255,21,21,21,255,21,21,21,255,19,19,19,255,18,18,18,255,16,16,16,255,
+    13,13,13,255,9,9,9,255,4,4,4,255,4,4,4,255,2,2,2,255,1,1,1,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,1,1,1,255,1,1,1,255,1,1,1,255,
+    2,2,2,255,6,6,6,255,9,9,9,255,12,12,12,255,14,14,14,255,15,15,15,255,16,16,16,255,16,16,16,255,
+    16,16,16,255,15,15,15,255,14,14,14,255,13,13,13,255,11,11,11,255,8,8,8,255,5,5,5,255,1,1,1,255,
+    1,1,1,255,1,1,1,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,1,1,1,255,1,1,1,255,1,1,1,255,2,2,2,255,6,6,6,255,9,9,9,255,
+    12,12,12,255,14,14,14,255,15,15,15,255,16,16,16,255,16,16,16,255,16,16,16,255,15,15,15,255,14,14,14,255,
+    13,13,13,255,11,11,11,255,8,8,8,255,5,5,5,255,1,1,1,255,1,1,1,255,1,1,1,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,1,1,1,255,
+    1,1,1,255,1,1,1,255,2,2,2,255,6,6,6,255,9,9,9,255,12,12,12,255,14,14,14,255,15,15,15,255,
+    16,16,16,255,16,16,16,255,16,16,16,255,15,15,15,255,14,14,14,255,13,13,13,255,11,11,11,255,8,8,8,255,
+    5,5,5,255,1,1,1,255,1,1,1,255,1,1,1,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,255,91,91,91,255,199,199,199,255,
+    175,175,175,255,5,5,5,255,0,0,0,255,0,0,0,179,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,2,2,2,255,3,3,3,255,
+    6,6,6,255,16,16,16,255,26,26,26,255,35,35,35,255,56,56,56,255,75,75,75,255,89,89,89,255,108,108,108,255,
+    126,126,126,255,142,142,142,255,152,152,152,255,162,162,162,255,169,169,169,255,173,173,173,255,177,177,177,255,179,179,179,255,
+    181,181,181,255,182,182,182,255,182,182,182,255,182,182,182,255,181,181,181,255,180,180,180,255,178,178,178,255,176,176,176,255,
+    173,173,173,255,169,169,169,255,157,157,157,255,144,144,144,255,129,129,129,255,112,112,112,255,96,96,96,255,82,82,82,255,
+    71,71,71,255,55,55,55,255,21,21,21,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,1,1,1,255,1,1,1,255,3,3,3,255,13,13,13,255,21,21,21,255,
+    29,29,29,255,49,49,49,255,67,67,67,255,81,81,81,255,100,100,100,255,120,120,120,255,136,136,136,255,146,146,146,255,
+    157,157,157,255,164,164,164,255,169,169,169,255,173,173,173,255,175,175,175,255,177,177,177,255,178,178,178,255,178,178,178,255,
+    178,178,178,255,177,177,177,255,176,176,176,255,174,174,174,255,171,171,171,255,168,168,168,255,163,163,163,255,150,150,150,255,
+    136,136,136,255,120,120,120,255,103,103,103,255,86,86,86,255,72,72,72,255,62,62,62,255,46,46,46,255,16,16,16,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,2,2,2,255,10,10,10,255,18,18,18,255,26,26,26,255,45,45,45,255,63,63,63,255,
+    77,77,77,255,97,97,97,255,117,117,117,255,133,133,133,255,143,143,143,255,155,155,155,255,162,162,162,255,167,167,167,255,
+    171,171,171,255,174,174,174,255,176,176,176,255,177,177,177,255,177,177,177,255,177,177,177,255,176,176,176,255,174,174,174,255,
+    172,172,172,255,169,169,169,255,166,166,166,255,161,161,161,255,147,147,147,255,134,134,134,255,117,117,117,255,99,99,99,255,
+    82,82,82,255,68,68,68,255,58,58,58,255,43,43,43,255,14,14,14,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,2,2,2,255,
+    10,10,10,255,18,18,18,255,26,26,26,255,45,45,45,255,63,63,63,255,77,77,77,255,97,97,97,255,117,117,117,255,
+    133,133,133,255,143,143,143,255,155,155,155,255,162,162,162,255,167,167,167,255,171,171,171,255,174,174,174,255,176,176,176,255,
+    177,177,177,255,177,177,177,255,177,177,177,255,176,176,176,255,174,174,174,255,172,172,172,255,169,169,169,255,166,166,166,255,
+    161,161,161,255,147,147,147,255,134,134,134,255,117,117,117,255,99,99,99,255,82,82,82,255,68,68,68,255,58,58,58,255,
+    43,43,43,255,14,14,14,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,255,114,114,114,255,199,199,199,255,
+    191,191,191,255,15,15,15,255,0,0,0,255,0,0,0,179,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,255,0,0,0,255,1,1,1,255,64,64,64,255,89,89,89,255,114,114,114,255,138,138,138,255,
+    158,158,158,255,174,174,174,255,188,188,188,255,200,200,200,255,205,205,205,255,208,208,208,255,211,211,211,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,209,209,209,255,
+    207,207,207,255,205,205,205,255,96,96,96,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,
+    4,4,4,255,59,59,59,255,82,82,82,255,107,107,107,255,132,132,132,255,153,153,153,255,170,170,170,255,186,186,186,255,
+    199,199,199,255,204,204,204,255,207,207,207,255,211,211,211,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,211,211,211,255,209,209,209,255,206,206,206,255,203,203,203,255,85,85,85,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,3,3,3,255,54,54,54,255,77,77,77,255,
+    104,104,104,255,129,129,129,255,150,150,150,255,168,168,168,255,185,185,185,255,198,198,198,255,203,203,203,255,207,207,207,255,
+    211,211,211,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    211,211,211,255,209,209,209,255,206,206,206,255,203,203,203,255,81,81,81,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,0,0,0,255,3,3,3,255,54,54,54,255,77,77,77,255,104,104,104,255,129,129,129,255,150,150,150,255,
+    168,168,168,255,185,185,185,255,198,198,198,255,203,203,203,255,207,207,207,255,211,211,211,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,211,211,211,255,208,208,208,255,202,202,202,255,
+    202,202,202,255,207,207,207,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,211,211,211,255,209,209,209,255,206,206,206,255,
+    203,203,203,255,81,81,81,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,0,0,166,0,0,0,255,74,74,74,255,198,198,198,255,
+    158,158,158,255,2,2,2,255,0,0,0,255,0,0,0,202,0,0,0,52,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,255,0,0,0,255,9,9,9,255,190,190,190,255,211,211,211,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    204,204,204,255,211,211,211,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,211,211,211,255,201,201,201,255,
+    184,184,184,255,181,179,180,255,191,190,190,255,206,206,206,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,99,99,99,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,
+    19,19,19,255,193,193,193,255,211,211,211,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,204,199,199,255,211,211,211,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,210,210,210,255,202,195,196,255,193,174,177,255,190,170,172,255,196,181,183,255,
+    206,202,202,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,88,88,88,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,18,18,18,255,193,193,193,255,211,211,211,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,84,84,84,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,0,0,0,255,18,18,18,255,193,193,193,255,211,211,211,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,210,210,210,255,190,190,190,255,140,140,140,255,83,83,83,255,46,46,46,255,31,31,31,255,
+    30,30,30,255,44,44,44,255,86,86,86,255,162,162,162,255,210,210,210,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,84,84,84,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,201,0,0,0,255,0,0,0,255,4,4,4,255,72,72,72,255,
+    28,28,28,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,248,0,0,0,19,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,255,0,0,0,255,24,24,24,255,201,201,201,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,168,168,168,255,
+    48,48,48,255,105,105,105,255,174,174,174,255,205,205,205,255,208,208,208,255,168,168,168,255,89,89,89,255,36,36,36,255,
+    17,17,17,255,45,12,18,255,106,16,34,255,77,45,51,255,113,113,113,255,192,192,192,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,99,99,99,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,
+    35,35,35,255,203,203,203,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,183,152,156,255,141,33,51,255,159,90,101,255,187,163,166,255,
+    206,201,202,255,208,206,206,255,184,153,157,255,154,71,85,255,139,24,45,255,135,8,32,255,135,5,30,255,136,10,34,255,
+    143,34,54,255,163,98,108,255,198,185,186,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,88,88,88,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,34,34,34,255,203,203,203,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,207,207,207,255,146,146,146,255,207,207,207,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,84,84,84,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,0,0,0,255,34,34,34,255,203,203,203,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    206,206,206,255,163,163,163,255,83,83,83,255,22,22,22,255,1,1,1,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,9,9,9,255,115,115,115,255,210,210,210,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,84,84,84,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,5,1,1,1,53,12,12,12,243,26,26,27,255,35,35,36,255,38,38,39,255,36,36,37,255,
+    28,29,30,255,17,17,18,255,3,3,3,255,0,0,0,255,0,0,0,255,0,0,0,98,0,0,0,12,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,255,0,0,0,255,38,38,38,255,205,205,205,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,167,167,167,255,37,37,37,255,
+    114,114,114,255,140,140,140,255,68,68,68,255,49,49,49,255,67,67,67,255,12,12,12,255,52,52,52,255,132,132,132,255,
+    163,163,163,255,157,156,156,255,125,96,102,255,59,14,23,255,65,0,13,255,39,34,35,255,165,165,165,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,99,99,99,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,
+    49,49,49,255,206,206,206,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,211,211,211,255,181,150,153,255,137,21,42,255,159,97,106,255,172,126,133,255,143,49,64,255,
+    142,34,53,255,146,50,67,255,136,6,31,255,138,35,53,255,167,117,124,255,182,152,156,255,179,143,148,255,155,81,94,255,
+    136,9,33,255,135,0,27,255,140,23,45,255,182,153,157,255,212,212,212,255,212,212,212,255,212,212,212,255,88,88,88,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,49,49,49,255,206,206,206,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,211,211,211,255,122,122,122,255,137,137,137,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,84,84,84,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,0,0,0,255,49,49,49,255,206,206,206,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,205,205,205,255,149,149,149,255,
+    59,59,59,255,7,7,7,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,1,1,1,255,6,6,6,255,
+    8,8,8,255,5,5,5,255,0,0,0,255,0,0,0,255,9,9,9,255,164,164,164,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,84,84,84,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,22,0,0,0,178,0,0,0,232,0,0,0,162,0,0,0,12,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,39,40,40,91,
+    80,80,82,174,93,94,96,242,115,116,118,255,124,125,127,255,122,123,125,255,120,121,123,255,118,118,121,255,115,115,118,255,
+    111,112,115,255,108,109,111,255,102,103,106,255,82,83,85,255,55,56,57,255,25,25,26,255,1,1,1,249,0,0,0,191,
+    0,0,0,110,0,0,0,23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,61,0,0,0,55,0,0,0,1,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,255,0,0,0,255,50,50,50,255,210,210,210,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,211,211,211,255,161,161,161,255,46,46,46,255,151,151,151,255,
+    211,211,211,255,205,205,205,255,104,104,104,255,31,31,31,255,96,96,96,255,63,63,63,255,30,30,30,255,134,134,134,255,
+    211,211,211,255,212,212,212,255,212,212,212,255,171,166,167,255,106,27,42,255,44,0,8,255,110,61,70,255,209,209,209,255,
+    212,212,212,255,212,212,212,255,99,99,99,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,
+    63,63,63,255,210,210,210,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,211,211,211,255,177,143,148,255,137,26,45,255,174,137,142,255,210,210,210,255,205,201,201,255,154,82,93,255,
+    137,18,39,255,154,79,91,255,146,48,65,255,137,17,39,255,168,119,126,255,211,211,211,255,212,212,212,255,211,211,211,255,
+    181,152,156,255,138,18,40,255,136,0,27,255,146,48,65,255,208,207,207,255,212,212,212,255,212,212,212,255,88,88,88,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,63,63,63,255,210,210,210,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,203,203,203,255,86,86,86,255,
+    152,152,152,255,210,210,210,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,84,84,84,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,0,0,0,255,63,63,63,255,210,210,210,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,176,176,176,255,60,60,60,255,4,4,4,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,9,9,9,255,52,52,52,255,116,116,116,255,163,163,163,255,
+    162,162,162,255,134,134,134,255,44,44,44,255,0,0,0,255,0,0,0,255,103,103,103,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,84,84,84,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,19,0,0,0,210,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,189,0,0,0,10,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,2,29,67,67,68,142,102,103,104,240,132,133,135,255,
+    135,135,138,255,135,136,138,255,135,136,138,255,134,134,137,255,132,133,135,255,130,130,133,255,127,128,130,255,124,124,127,255,
+    120,121,123,255,116,117,119,255,112,113,115,255,107,108,111,255,102,103,106,255,97,98,101,255,81,82,85,255,42,42,44,255,
+    6,7,7,255,0,0,0,249,0,0,0,168,0,0,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,12,0,0,0,187,0,0,0,255,0,0,0,255,0,0,0,167,0,0,0,2,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,255,0,0,0,255,64,64,64,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,211,211,211,255,159,159,159,255,52,52,52,255,172,172,172,255,212,212,212,255,
+    212,212,212,255,188,188,188,255,85,85,85,255,183,183,183,255,212,212,212,255,210,210,210,255,152,152,152,255,17,17,17,255,
+    184,184,184,255,212,212,212,255,212,212,212,255,212,212,212,255,160,158,159,255,95,9,26,255,149,48,66,255,209,207,207,255,
+    212,212,212,255,212,212,212,255,100,100,100,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,
+    76,76,76,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    211,211,211,255,178,141,146,255,138,33,51,255,184,160,163,255,212,212,212,255,212,212,212,255,193,177,179,255,149,67,80,255,
+    190,173,175,255,211,211,211,255,210,209,209,255,175,135,141,255,136,9,33,255,192,175,176,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,179,144,149,255,136,5,31,255,145,36,55,255,207,204,204,255,212,212,212,255,212,212,212,255,89,89,89,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,76,76,76,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,211,211,211,255,119,119,119,255,
+    73,73,73,255,105,105,105,255,195,195,195,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,84,84,84,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,0,0,0,255,76,76,76,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,203,203,203,255,39,39,39,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,10,10,10,255,68,68,68,255,140,140,140,255,190,190,190,255,211,211,211,255,212,212,212,255,
+    195,195,195,255,168,168,168,255,101,101,101,255,0,0,0,255,0,0,0,255,89,89,89,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,84,84,84,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,
+    0,0,0,209,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,190,0,0,0,46,
+    0,0,0,106,0,0,0,10,0,0,0,20,56,57,58,150,113,113,115,248,140,141,143,255,143,144,146,255,145,146,148,255,
+    146,147,149,255,146,147,149,255,146,146,148,255,144,145,147,255,142,143,145,255,139,140,142,255,136,137,139,255,133,133,136,255,
+    129,129,132,255,124,125,128,255,120,120,123,255,115,116,118,255,110,110,113,255,104,105,108,255,99,100,103,255,91,92,95,255,
+    77,78,80,255,38,38,39,255,3,3,3,255,0,0,0,254,0,0,0,180,0,0,0,41,0,0,0,0,0,0,0,0,
+    0,0,0,1,0,0,0,17,0,0,0,200,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,159,
+    0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,255,0,0,0,255,78,78,78,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    210,210,210,255,181,181,181,255,128,128,128,255,115,115,115,255,24,24,24,255,103,103,103,255,137,137,137,255,137,137,137,255,
+    140,140,140,255,152,152,152,255,185,185,185,255,210,210,210,255,212,212,212,255,212,212,212,255,193,193,193,255,19,19,19,255,
+    161,161,161,255,212,212,212,255,212,212,212,255,212,212,212,255,211,211,211,255,138,86,96,255,153,60,76,255,210,209,209,255,
+    212,212,212,255,212,212,212,255,101,101,101,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,
+    91,91,91,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,209,208,208,255,187,167,169,255,166,110,119,255,
+    160,96,106,255,136,12,35,255,149,79,88,255,171,121,128,255,171,121,129,255,171,123,130,255,175,137,142,255,189,173,174,255,
+    208,208,208,255,212,212,212,255,212,212,212,255,198,186,187,255,135,10,33,255,182,150,154,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,210,210,210,255,152,70,84,255,148,46,64,255,209,207,207,255,212,212,212,255,212,212,212,255,90,90,90,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,91,91,91,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,207,207,207,255,65,65,65,255,
+    173,173,173,255,162,158,159,255,64,48,50,255,119,119,119,255,198,198,198,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,86,86,86,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,0,0,0,255,91,91,91,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,195,195,195,255,13,13,13,255,0,0,0,255,0,0,0,255,
+    3,3,3,255,61,61,61,255,140,140,140,255,169,169,169,255,196,196,196,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    190,190,190,255,168,168,168,255,82,82,82,255,0,0,0,255,0,0,0,255,114,114,114,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,86,86,86,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,138,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,49,49,49,255,66,66,66,255,6,6,6,255,0,0,0,252,
+    0,0,0,255,7,7,7,207,90,90,92,235,142,143,145,255,147,148,150,255,151,152,154,255,154,155,157,255,156,157,159,255,
+    157,158,160,255,157,158,159,255,156,157,158,255,154,155,157,255,152,152,154,255,149,149,151,255,145,146,148,255,141,142,144,255,
+    137,138,140,255,132,133,135,255,127,128,130,255,122,123,125,255,116,117,120,255,111,112,114,255,105,106,109,255,99,100,103,255,
+    91,92,95,255,79,80,83,255,59,59,61,255,15,15,15,255,0,0,0,255,0,0,0,249,0,0,0,137,0,0,0,203,
+    0,0,0,209,0,0,0,205,0,0,0,255,40,40,40,255,43,43,43,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,129,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,255,0,0,0,255,92,92,92,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,211,211,211,255,172,172,172,255,
+    69,69,69,255,24,24,24,255,26,26,26,255,45,45,45,255,98,98,98,255,108,108,108,255,122,122,122,255,134,134,134,255,
+    144,144,144,255,139,139,139,255,82,82,82,255,53,53,53,255,133,133,133,255,204,204,204,255,197,197,197,255,25,25,25,255,
+    164,164,164,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,205,198,199,255,193,171,173,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,103,103,103,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,
+    105,105,105,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,211,210,210,255,183,155,159,255,145,50,66,255,135,11,34,255,135,12,34,255,
+    140,33,52,255,157,83,96,255,160,93,104,255,165,106,115,255,169,118,126,255,173,128,134,255,171,123,130,255,150,63,77,255,
+    140,36,54,255,169,118,126,255,204,200,200,255,200,190,191,255,136,13,35,255,183,152,156,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,203,192,193,255,188,158,161,255,212,212,212,255,212,212,212,255,212,212,212,255,91,91,91,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,105,105,105,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,190,190,190,255,34,34,34,255,
+    198,198,198,255,250,245,246,255,160,86,92,255,101,51,53,255,53,38,39,255,100,99,100,255,174,174,174,255,208,208,208,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,87,87,87,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,0,0,0,255,105,105,105,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,115,115,115,255,5,5,5,255,2,2,2,255,
+    62,62,62,255,163,163,163,255,168,168,168,255,191,191,191,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    180,180,180,255,163,163,163,255,35,35,35,255,0,0,0,255,8,8,8,255,168,168,168,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,87,87,87,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,173,
+    0,0,0,255,0,0,0,255,0,0,0,255,3,3,3,255,99,99,99,255,111,111,111,255,35,35,35,255,0,0,0,255,
+    18,18,19,255,117,118,119,255,147,148,150,255,154,154,156,255,159,159,161,255,163,163,165,255,166,166,168,255,167,168,170,255,
+    168,169,170,255,168,168,170,255,166,167,168,255,164,164,166,255,161,162,163,255,158,158,160,255,154,154,156,255,149,150,152,255,
+    144,145,147,255,139,140,142,255,134,135,137,255,129,129,132,255,123,124,126,255,117,118,120,255,111,112,115,255,105,106,109,255,
+    99,100,103,255,90,91,94,255,77,78,80,255,62,62,64,255,24,24,25,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,11,11,11,255,98,98,98,255,96,96,96,255,8,8,8,255,0,0,0,255,0,0,0,255,
+    0,0,0,243,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,255,0,0,0,255,104,104,104,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,206,206,206,255,113,113,113,255,23,23,23,255,
+    73,73,73,255,136,136,136,255,97,97,97,255,190,190,190,255,211,211,211,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,210,210,210,255,163,163,163,255,42,42,42,255,45,45,45,255,156,156,156,255,27,27,27,255,
+    170,170,170,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,104,104,104,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,
+    117,117,117,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,205,201,201,255,159,92,102,255,134,11,33,255,119,44,56,255,126,98,101,255,144,66,76,255,
+    193,182,183,255,211,211,211,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,210,209,209,255,
+    182,149,153,255,141,29,50,255,142,34,54,255,172,137,142,255,135,15,37,255,185,158,162,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,93,93,93,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,117,117,117,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,160,160,160,255,36,36,36,255,
+    201,201,201,255,247,238,240,255,160,84,90,255,153,78,81,255,149,75,78,255,111,57,59,255,60,34,35,255,56,51,51,255,
+    108,108,108,255,167,167,167,255,204,204,204,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,89,89,89,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,0,0,0,255,117,117,117,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,210,210,210,255,181,181,181,255,169,169,169,255,
+    173,173,173,255,171,171,171,255,181,181,181,255,209,209,209,255,212,212,212,255,212,212,212,255,212,212,212,255,207,207,207,255,
+    171,171,171,255,118,118,118,255,4,4,4,255,0,0,0,255,59,59,59,255,207,207,207,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,89,89,89,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,88,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,40,40,40,255,67,67,67,255,9,9,9,255,28,29,29,255,
+    131,131,133,255,151,152,153,255,158,159,161,255,165,166,167,255,170,171,172,255,174,175,176,255,177,178,179,255,179,179,181,255,
+    179,179,181,255,178,179,180,255,176,177,178,255,173,174,176,255,170,171,172,255,166,167,168,255,162,162,164,255,157,157,159,255,
+    152,152,154,255,146,147,149,255,141,141,144,255,135,136,138,255,129,130,132,255,123,124,126,255,117,118,120,255,110,111,114,255,
+    104,105,108,255,97,98,101,255,87,88,91,255,74,74,77,255,58,58,60,255,27,27,28,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,2,2,2,255,51,51,51,255,42,42,42,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,241,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,255,0,0,0,255,115,115,115,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,203,203,203,255,84,84,84,255,41,41,41,255,122,122,122,255,
+    145,145,145,255,86,86,86,255,170,170,170,255,211,211,211,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,195,195,195,255,79,79,79,255,20,20,20,255,12,12,12,255,
+    175,175,175,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,106,106,106,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,
+    128,128,128,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,202,196,197,255,149,61,75,255,127,21,40,255,109,81,85,255,107,101,102,255,119,46,55,255,171,153,155,255,
+    210,210,210,255,211,211,211,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,199,188,189,255,150,62,77,255,135,7,31,255,136,6,31,255,187,165,167,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,94,94,94,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,128,128,128,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,127,127,127,255,56,56,56,255,
+    201,201,201,255,242,226,229,255,157,81,85,255,153,78,81,255,153,78,81,255,153,78,81,255,152,77,80,255,138,70,73,255,
+    96,49,51,255,53,29,30,255,43,38,38,255,83,83,83,255,140,140,140,255,186,186,186,255,208,208,208,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,90,90,90,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,0,0,0,255,128,128,128,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    211,211,211,255,208,208,208,255,211,211,211,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,193,193,193,255,
+    158,158,158,255,35,35,35,255,0,0,0,255,10,10,10,255,159,159,159,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,90,90,90,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,126,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,26,26,27,255,134,135,137,255,
+    152,153,155,255,161,162,164,255,169,170,171,255,176,177,178,255,182,182,184,255,186,186,188,255,189,189,190,255,190,190,192,255,
+    190,190,191,255,188,189,190,255,186,186,188,255,183,183,184,255,179,179,181,255,174,175,176,255,169,170,171,255,164,165,166,255,
+    159,159,161,255,153,153,155,255,147,147,150,255,141,141,144,255,135,135,138,255,128,129,131,255,122,123,125,255,115,116,119,255,
+    109,110,113,255,102,103,106,255,95,96,99,255,83,84,87,255,68,69,71,255,51,52,53,255,23,23,24,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,116,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,255,0,0,0,255,124,124,124,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,207,207,207,255,86,86,86,255,64,64,64,255,141,141,141,255,150,150,150,255,
+    107,107,107,255,136,136,136,255,203,203,203,255,211,211,211,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,205,205,205,255,105,105,105,255,6,6,6,255,
+    93,93,93,255,206,206,206,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,108,108,108,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,
+    138,138,138,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    206,203,203,255,149,63,77,255,121,37,50,255,108,97,98,255,107,106,106,255,116,63,69,255,130,102,105,255,196,196,196,255,
+    211,211,211,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,205,201,202,255,158,87,98,255,136,3,29,255,154,77,90,255,206,203,203,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,97,97,97,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,138,138,138,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,211,211,211,255,100,100,100,255,72,72,72,255,
+    200,200,200,255,233,210,214,255,154,79,82,255,153,78,81,255,153,78,81,255,153,78,81,255,153,78,81,255,153,78,81,255,
+    153,78,81,255,151,77,80,255,137,69,72,255,99,51,53,255,55,29,30,255,30,22,22,255,50,50,50,255,106,106,106,255,
+    166,166,166,255,205,205,205,255,212,212,212,255,212,212,212,255,92,92,92,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,0,0,0,255,138,138,138,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,210,210,210,255,175,175,175,255,
+    83,83,83,255,1,1,1,255,1,1,1,255,94,94,94,255,209,209,209,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,92,92,92,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,131,0,0,0,255,0,0,0,255,0,0,0,255,13,14,14,255,127,128,130,255,152,152,154,255,
+    162,162,164,255,171,172,173,255,180,180,182,255,187,188,189,255,193,193,195,255,197,198,199,255,200,200,201,255,201,201,202,255,
+    200,200,201,255,198,198,199,255,195,195,197,255,191,192,193,255,187,187,188,255,182,182,183,255,176,177,178,255,171,171,173,255,
+    165,165,167,255,159,159,161,255,152,153,155,255,146,147,149,255,140,140,143,255,133,134,136,255,127,127,130,255,120,121,123,255,
+    113,114,117,255,106,107,110,255,100,101,104,255,91,92,95,255,77,78,80,255,61,62,63,255,43,44,45,255,15,15,15,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,121,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,255,0,0,0,255,133,133,133,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,211,211,211,255,119,119,119,255,46,46,46,255,147,147,147,255,151,151,151,255,159,159,159,255,
+    184,184,184,255,207,207,207,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,204,204,204,255,38,38,38,255,
+    2,2,2,255,101,101,101,255,211,211,211,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,110,110,110,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,
+    146,146,146,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,210,210,210,255,
+    160,96,106,255,125,25,42,255,107,103,103,255,107,107,107,255,122,122,122,255,177,168,169,255,204,203,203,255,211,211,211,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,204,199,199,255,139,26,47,255,136,1,27,255,156,86,98,255,210,210,210,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,98,98,98,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,146,146,146,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,210,210,210,255,77,77,77,255,73,73,73,255,
+    197,197,197,255,225,194,199,255,154,78,82,255,153,78,81,255,153,78,81,255,151,77,80,255,147,75,78,255,143,73,75,255,
+    136,70,72,255,130,66,69,255,123,63,65,255,116,60,62,255,110,58,60,255,96,53,54,255,59,40,40,255,27,27,27,255,
+    34,34,34,255,92,92,92,255,208,208,208,255,212,212,212,255,94,94,94,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,0,0,0,255,146,146,146,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,198,198,198,255,129,129,129,255,
+    10,10,10,255,0,0,0,255,52,52,52,255,196,196,196,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,94,94,94,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,15,0,0,0,232,0,0,0,255,2,2,2,255,106,106,108,255,149,150,152,255,160,161,163,255,
+    171,171,173,255,181,181,183,255,190,190,192,255,198,198,199,255,204,205,206,255,209,209,210,255,211,211,212,255,212,212,213,255,
+    210,211,211,255,207,208,209,255,204,204,205,255,199,199,200,255,194,194,195,255,188,189,190,255,182,183,184,255,176,177,178,255,
+    170,171,172,255,164,164,166,255,157,158,160,255,151,151,153,255,144,145,147,255,137,138,140,255,131,132,134,255,124,125,127,255,
+    117,118,121,255,110,111,114,255,103,104,107,255,96,97,100,255,85,85,88,255,69,70,72,255,52,52,54,255,33,33,34,255,
+    6,6,6,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,254,0,0,0,113,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,255,0,0,0,255,140,140,140,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,171,171,171,255,18,18,18,255,102,102,102,255,151,151,151,255,159,159,159,255,200,200,200,255,
+    210,210,210,255,211,211,211,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,210,210,210,255,77,77,77,255,
+    73,73,73,255,24,24,24,255,165,165,165,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,112,112,112,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,2,2,2,255,
+    152,152,152,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,182,154,157,255,
+    135,8,32,255,112,65,72,255,108,107,107,255,121,121,121,255,191,191,191,255,207,207,207,255,211,211,211,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,209,207,208,255,148,59,74,255,143,51,66,255,137,13,36,255,182,151,155,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,100,100,100,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,2,2,2,255,152,152,152,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,207,207,207,255,57,57,57,255,64,64,64,255,
+    169,169,169,255,184,159,163,255,99,51,53,255,78,40,42,255,62,34,35,255,54,35,36,255,57,44,45,255,69,60,61,255,
+    86,80,81,255,105,102,102,255,126,124,124,255,142,141,141,255,157,157,157,255,171,171,171,255,184,184,184,255,196,196,196,255,
+    198,198,198,255,198,198,198,255,211,211,211,255,212,212,212,255,96,96,96,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,2,2,2,255,152,152,152,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,211,211,211,255,167,167,167,255,33,33,33,255,
+    0,0,0,255,25,25,25,255,175,175,175,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,96,96,96,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,55,0,0,0,255,0,0,0,255,65,65,66,255,144,145,147,255,156,157,159,255,168,168,170,255,
+    179,180,181,255,190,190,192,255,200,200,201,255,209,209,210,255,216,216,217,255,221,221,221,255,223,223,223,255,222,223,223,255,
+    220,220,221,255,216,217,217,255,211,212,213,255,206,206,207,255,200,201,202,255,194,195,196,255,188,189,190,255,182,182,184,255,
+    175,176,177,255,169,169,171,255,162,162,164,255,155,156,158,255,148,149,151,255,141,142,144,255,135,135,138,255,128,128,131,255,
+    121,121,124,255,114,115,117,255,107,108,111,255,100,101,104,255,91,91,94,255,76,77,79,255,60,60,62,255,41,42,43,255,
+    21,21,22,255,1,1,1,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,89,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,255,1,1,1,255,145,145,145,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,206,206,206,255,71,71,71,255,73,73,73,255,150,150,150,255,153,153,153,255,194,194,194,255,210,210,210,255,
+    211,211,211,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,148,148,148,255,
+    148,148,148,255,150,150,150,255,67,67,67,255,209,209,209,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,114,114,114,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,3,3,3,255,
+    156,156,156,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,206,202,202,255,145,50,66,255,
+    119,44,56,255,107,106,107,255,111,111,111,255,181,181,181,255,207,207,207,255,209,209,209,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,174,131,137,255,175,135,141,255,174,133,139,255,146,52,68,255,
+    209,208,208,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,103,103,103,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,3,3,3,255,156,156,156,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,211,211,211,255,141,141,141,255,77,77,77,255,15,15,15,255,11,11,11,255,
+    35,35,35,255,60,60,60,255,87,87,87,255,123,123,123,255,157,157,157,255,183,183,183,255,199,199,199,255,207,207,207,255,
+    211,211,211,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,98,98,98,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,3,3,3,255,156,156,156,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,198,198,198,255,73,73,73,255,1,1,1,255,
+    10,10,10,255,144,144,144,255,211,211,211,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,98,98,98,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,182,14,14,14,255,132,133,135,255,150,151,153,255,162,163,165,255,175,175,177,255,
+    186,187,188,255,198,198,199,255,209,209,210,255,219,219,219,255,227,227,227,255,232,232,232,255,234,234,234,255,232,232,233,255,
+    229,229,229,255,224,224,225,255,218,218,219,255,212,213,213,255,206,206,207,255,199,200,201,255,193,193,194,255,186,186,188,255,
+    179,180,181,255,172,173,174,255,166,166,168,255,159,159,161,255,152,152,154,255,145,145,148,255,138,138,141,255,131,131,134,255,
+    124,124,127,255,117,117,120,255,110,110,113,255,103,103,106,255,95,96,99,255,82,83,85,255,66,67,69,255,48,49,50,255,
+    29,29,30,255,7,8,8,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,73,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,255,1,1,1,255,150,150,150,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    211,211,211,255,115,115,115,255,41,41,41,255,148,148,148,255,151,151,151,255,176,176,176,255,209,209,209,255,210,210,210,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,180,180,180,255,
+    128,128,128,255,210,210,210,255,63,63,63,255,178,178,178,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,116,116,116,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,4,4,4,255,
+    160,160,160,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,211,210,210,255,161,93,103,255,129,23,41,255,
+    113,106,107,255,108,108,108,255,150,150,150,255,206,206,206,255,208,208,208,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,189,167,170,255,167,113,121,255,209,208,208,255,143,45,62,255,
+    188,168,170,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,104,104,104,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,4,4,4,255,160,160,160,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,172,172,172,255,114,114,114,255,10,10,10,255,60,60,60,255,
+    174,174,174,255,207,207,207,255,211,211,211,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,100,100,100,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,4,4,4,255,160,160,160,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,210,210,210,255,127,127,127,255,4,4,4,255,3,3,3,255,
+    114,114,114,255,210,210,210,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,100,100,100,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,14,0,0,0,230,81,81,83,255,143,143,145,255,155,156,158,255,168,168,170,255,180,181,182,255,
+    193,193,194,255,205,205,206,255,217,217,218,255,228,228,228,255,237,237,238,255,243,243,244,255,244,244,244,255,241,241,241,255,
+    236,236,236,255,230,230,231,255,224,224,224,255,217,217,218,255,210,211,211,255,203,204,205,255,196,197,198,255,190,190,191,255,
+    183,183,184,255,176,176,178,255,169,169,171,255,162,162,164,255,154,155,157,255,147,148,150,255,140,141,143,255,133,134,136,255,
+    126,127,129,255,119,120,122,255,112,113,116,255,105,106,109,255,98,99,102,255,87,88,90,255,71,72,74,255,54,54,56,255,
+    35,35,36,255,15,15,15,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,252,0,0,0,49,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,255,1,1,1,255,154,154,154,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    202,202,202,255,41,41,41,255,131,131,131,255,214,214,214,255,155,155,155,255,203,203,203,255,210,210,210,255,211,211,211,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,203,203,203,255,
+    143,143,143,255,212,212,212,255,143,143,143,255,116,116,116,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,118,118,118,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,5,5,5,255,
+    163,163,163,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,203,196,196,255,138,24,44,255,151,112,117,255,
+    199,199,199,255,115,115,115,255,196,196,196,255,207,207,207,255,210,210,210,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,204,199,199,255,165,119,125,255,212,212,212,255,174,127,134,255,
+    163,101,111,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,106,106,106,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,5,5,5,255,163,163,163,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,174,174,174,255,7,7,7,255,75,75,75,255,
+    190,190,190,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,101,101,101,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,5,5,5,255,163,163,163,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,177,177,177,255,23,23,23,255,0,0,0,255,76,76,76,255,
+    205,205,205,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,101,101,101,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,140,12,12,12,255,130,131,133,255,147,147,149,255,159,160,162,255,172,173,174,255,185,185,187,255,
+    198,198,199,255,210,210,211,255,223,223,223,255,235,235,236,255,247,247,247,255,253,253,253,255,253,253,253,255,248,248,248,255,
+    241,241,242,255,234,235,235,255,228,228,228,255,221,221,221,255,213,214,215,255,206,207,208,255,199,200,201,255,192,193,194,255,
+    185,186,187,255,178,178,180,255,171,171,173,255,164,164,166,255,157,157,159,255,150,150,152,255,142,143,145,255,135,136,138,255,
+    128,129,131,255,121,122,125,255,114,115,118,255,107,108,111,255,100,101,104,255,90,91,94,255,76,77,79,255,59,59,61,255,
+    40,40,42,255,20,20,21,255,2,2,2,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,195,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,255,1,1,1,255,156,156,156,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    177,177,177,255,44,44,44,255,188,188,188,255,206,206,206,255,178,178,178,255,210,210,210,255,210,210,210,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    211,211,211,255,212,212,212,255,173,173,173,255,40,40,40,255,200,200,200,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,120,120,120,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,6,6,6,255,
+    166,166,166,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,187,161,165,255,129,24,42,255,174,172,172,255,
+    186,186,186,255,153,153,153,255,207,207,207,255,207,207,207,255,211,211,211,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,211,211,211,255,212,212,212,255,186,159,162,255,
+    140,28,48,255,202,195,195,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,108,108,108,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,6,6,6,255,166,166,166,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,133,133,133,255,0,0,0,255,91,91,91,255,
+    192,192,192,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,103,103,103,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,6,6,6,255,166,166,166,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,205,205,205,255,73,73,73,255,0,0,0,255,36,36,36,255,194,194,194,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,103,103,103,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,22,0,0,0,245,61,61,63,255,137,137,140,255,149,150,152,255,162,163,165,255,175,175,177,255,188,188,189,255,
+    201,201,202,255,213,214,214,255,226,226,227,255,239,239,239,255,251,251,251,255,255,255,255,255,255,255,255,255,251,251,251,255,
+    244,244,244,255,237,237,237,255,229,230,230,255,222,223,223,255,215,215,216,255,208,208,209,255,201,201,202,255,194,194,195,255,
+    187,187,189,255,180,180,182,255,173,173,175,255,165,166,168,255,158,159,161,255,151,152,154,255,144,145,147,255,137,138,140,255,
+    130,131,133,255,123,123,126,255,116,116,119,255,108,109,112,255,101,102,105,255,93,94,97,255,79,80,82,255,63,63,65,255,
+    44,45,46,255,24,25,26,255,5,5,5,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,69,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,255,1,1,1,255,159,159,159,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    144,144,144,255,82,82,82,255,202,202,202,255,189,189,189,255,202,202,202,255,210,210,210,255,211,211,211,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,209,209,209,255,46,46,46,255,130,130,130,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,121,121,121,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,6,6,6,255,
+    167,167,167,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,173,124,131,255,124,56,67,255,191,191,191,255,
+    162,162,162,255,195,195,195,255,209,209,209,255,209,209,209,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,208,206,206,255,
+    141,30,50,255,167,115,123,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,109,109,109,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,6,6,6,255,167,167,167,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,210,210,210,255,83,83,83,255,1,1,1,255,114,114,114,255,
+    196,196,196,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,104,104,104,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,6,6,6,255,167,167,167,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,211,211,211,255,144,144,144,255,5,5,5,255,8,8,8,255,157,157,157,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,104,104,104,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,130,0,0,0,255,104,104,106,255,138,139,141,255,151,152,154,255,164,164,166,255,177,177,179,255,189,190,191,255,
+    202,202,203,255,214,215,215,255,227,227,227,255,238,239,239,255,249,249,249,255,254,254,254,255,254,254,254,255,249,249,250,255,
+    243,243,243,255,236,237,237,255,230,230,230,255,223,223,224,255,216,216,217,255,209,209,210,255,202,202,203,255,195,195,196,255,
+    188,188,189,255,181,181,182,255,173,174,176,255,166,167,169,255,159,160,162,255,152,153,155,255,145,146,148,255,138,139,141,255,
+    131,132,134,255,124,125,127,255,117,118,120,255,109,110,113,255,102,103,106,255,94,95,98,255,82,82,85,255,65,66,68,255,
+    47,48,49,255,28,28,29,255,8,8,8,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,186,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,255,1,1,1,255,160,160,160,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    120,120,120,255,100,100,100,255,208,208,208,255,185,185,185,255,211,211,211,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,225,225,225,255,143,143,143,255,77,77,77,255,211,211,211,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,122,122,122,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,6,6,6,255,
+    169,169,169,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,163,99,110,255,119,68,76,255,199,199,199,255,
+    160,160,161,255,211,211,211,255,211,211,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,228,228,228,255,
+    194,129,142,255,149,63,78,255,210,210,210,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,109,109,109,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,6,6,6,255,169,169,169,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,202,202,202,255,39,39,39,255,4,4,4,255,138,138,138,255,
+    201,201,201,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,105,105,105,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,6,6,6,255,169,169,169,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,201,201,201,255,47,47,47,255,1,1,1,255,99,99,99,255,209,209,209,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,105,105,105,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,
+    0,0,0,228,12,12,12,255,127,127,130,255,139,140,142,255,152,153,155,255,164,165,167,255,177,177,179,255,189,190,191,255,
+    201,202,203,255,213,214,214,255,225,225,225,255,235,235,235,255,243,243,244,255,248,248,248,255,248,248,248,255,245,245,245,255,
+    240,240,241,255,234,235,235,255,228,228,229,255,222,222,223,255,215,215,216,255,208,209,210,255,201,202,203,255,195,195,196,255,
+    188,188,189,255,181,181,183,255,174,174,176,255,167,167,169,255,160,160,162,255,153,153,155,255,146,146,148,255,138,139,142,255,
+    131,132,135,255,124,125,128,255,117,118,121,255,110,111,114,255,103,104,107,255,96,97,99,255,83,84,87,255,67,68,70,255,
+    49,50,51,255,30,31,31,255,10,10,10,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,253,
+    0,0,0,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,255,1,1,1,255,160,160,160,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    103,103,103,255,40,40,40,255,207,207,207,255,190,190,190,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,229,229,229,255,159,159,159,255,74,74,74,255,211,211,211,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,122,122,122,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,6,6,6,255,
+    169,169,169,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,158,83,95,255,125,23,41,255,197,197,197,255,
+    171,171,171,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,232,232,232,255,
+    204,149,160,255,148,60,76,255,210,210,210,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,110,110,110,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,6,6,6,255,169,169,169,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,196,196,196,255,24,24,24,255,6,6,6,255,149,149,149,255,
+    206,206,206,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,105,105,105,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,6,6,6,255,169,169,169,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,184,184,184,255,10,10,10,255,27,27,27,255,190,190,191,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,105,105,105,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,66,
+    0,0,0,255,41,41,42,255,127,128,130,255,140,140,142,255,152,152,154,255,164,165,166,255,176,177,178,255,188,188,190,255,
+    200,200,201,255,210,211,212,255,221,221,222,255,230,230,230,255,236,237,237,255,240,241,241,255,241,241,242,255,239,239,240,255,
+    236,236,236,255,231,231,232,255,225,226,226,255,220,220,220,255,213,214,214,255,207,207,208,255,200,201,202,255,194,194,195,255,
+    187,187,189,255,180,181,182,255,173,174,175,255,166,167,169,255,159,160,162,255,152,153,155,255,146,146,148,255,139,139,142,255,
+    132,132,135,255,125,125,128,255,117,118,121,255,111,111,114,255,103,104,107,255,96,97,100,255,84,85,88,255,69,69,71,255,
+    51,51,53,255,32,32,33,255,11,12,12,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,125,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,255,1,1,1,255,160,160,160,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    102,102,102,255,25,25,25,255,198,198,198,255,195,195,195,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,232,232,232,255,127,127,127,255,98,98,98,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,122,122,122,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,6,6,6,255,
+    169,169,169,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,157,81,94,255,130,13,34,255,188,186,186,255,
+    180,180,180,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,235,235,235,255,
+    188,116,130,255,155,82,95,255,211,211,211,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,109,109,109,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,6,6,6,255,169,169,169,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,185,185,186,255,13,13,13,255,9,9,9,255,156,156,156,255,
+    210,210,210,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,105,105,105,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,6,6,6,255,169,169,169,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,186,186,186,255,10,10,10,255,25,25,25,255,192,192,192,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,105,105,105,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,146,
+    0,0,0,255,62,63,64,255,127,128,130,255,139,140,142,255,151,151,153,255,163,163,165,255,174,175,176,255,186,186,187,255,
+    196,197,198,255,206,207,208,255,216,216,217,255,223,224,224,255,229,229,230,255,233,233,233,255,234,234,235,255,233,233,234,255,
+    230,230,231,255,226,227,227,255,222,222,222,255,216,217,217,255,195,195,196,255,116,116,117,255,73,73,73,255,71,71,72,255,
+    108,108,109,255,168,168,170,255,172,173,174,255,166,166,168,255,159,159,161,255,152,153,155,255,145,146,148,255,138,139,141,255,
+    131,132,134,255,124,125,128,255,117,118,121,255,110,111,114,255,103,104,107,255,96,97,100,255,84,85,88,255,69,70,72,255,
+    51,52,53,255,32,33,34,255,12,12,13,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,205,0,0,0,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,255,1,1,1,255,158,158,158,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    124,124,124,255,11,11,11,255,179,179,179,255,200,200,200,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,237,237,237,255,90,90,90,255,114,114,114,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,121,121,121,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,6,6,6,255,
+    168,168,168,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,166,104,114,255,133,6,30,255,171,162,163,255,
+    186,186,186,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,240,240,240,255,
+    171,78,96,255,161,99,109,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,109,109,109,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,6,6,6,255,168,168,168,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,175,175,175,255,8,8,8,255,12,12,12,255,167,167,167,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,105,105,105,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,6,6,6,255,168,168,168,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,207,207,207,255,70,70,70,255,0,0,0,255,38,38,38,255,156,156,156,255,210,210,210,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,105,105,105,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,212,
+    0,0,0,255,77,77,79,255,125,126,129,255,137,138,140,255,149,150,152,255,160,161,163,255,172,172,174,255,182,183,184,255,
+    192,193,194,255,202,202,203,255,210,210,211,255,217,217,218,255,222,222,223,255,225,226,226,255,227,227,227,255,226,226,227,255,
+    224,224,225,255,221,221,222,255,217,217,218,255,150,150,151,255,14,14,14,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,15,15,15,255,126,126,127,255,164,165,166,255,158,158,160,255,151,152,154,255,144,145,147,255,137,138,140,255,
+    131,131,134,255,124,125,127,255,117,118,120,255,110,111,114,255,103,104,107,255,96,97,100,255,84,85,87,255,68,69,71,255,
+    51,52,53,255,32,32,33,255,12,12,13,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,244,0,0,0,71,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,255,1,1,1,255,157,157,157,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    166,166,166,255,6,6,6,255,147,147,147,255,205,205,205,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,239,239,239,255,47,47,47,255,149,149,149,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,120,120,120,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,6,6,6,255,
+    166,166,166,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,182,148,153,255,135,2,28,255,151,127,130,255,
+    190,190,190,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,243,240,241,255,
+    152,36,59,255,173,133,138,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,108,108,108,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,6,6,6,255,166,166,166,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,165,165,165,255,4,4,4,255,20,20,20,255,181,181,181,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,104,104,104,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,6,6,6,255,166,166,166,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,195,195,195,255,76,76,76,255,3,3,3,255,8,8,8,255,119,119,119,255,
+    211,211,211,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,104,104,104,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,47,0,0,0,205,0,0,0,254,
+    0,0,0,255,85,86,88,255,124,124,127,255,135,136,138,255,146,147,149,255,157,158,160,255,168,168,170,255,178,178,180,255,
+    187,188,189,255,196,196,197,255,203,204,205,255,210,210,211,255,214,215,215,255,218,218,219,255,219,219,220,255,219,219,220,255,
+    218,218,219,255,215,215,216,255,164,164,164,255,4,4,4,255,0,0,0,255,8,8,8,255,43,43,43,255,18,18,18,255,
+    0,0,0,255,0,0,0,255,5,5,5,255,121,122,123,255,156,156,158,255,149,150,152,255,143,143,146,255,136,137,139,255,
+    129,130,133,255,123,124,126,255,116,117,119,255,109,110,113,255,102,103,106,255,95,96,99,255,83,83,86,255,67,68,70,255,
+    50,50,52,255,31,31,32,255,11,11,12,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,200,0,0,0,155,0,0,0,155,0,0,0,156,0,0,0,115,0,0,0,7,
+    0,0,0,0,0,0,0,255,1,1,1,255,156,156,156,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    196,196,196,255,22,22,22,255,106,106,106,255,204,204,204,255,211,211,211,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,224,224,224,255,29,29,29,255,190,190,190,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,118,118,118,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,5,5,5,255,
+    165,165,165,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,199,186,188,255,136,10,34,255,127,81,88,255,
+    190,190,191,255,211,211,211,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,213,213,213,255,236,221,224,255,
+    140,18,40,255,193,180,182,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,106,106,106,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,5,5,5,255,165,165,165,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,158,158,158,255,2,2,2,255,28,28,28,255,196,196,196,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,102,102,102,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,5,5,5,255,165,165,165,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,207,207,207,255,136,136,136,255,36,36,36,255,110,110,110,255,
+    211,211,211,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,102,102,102,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,60,0,0,0,104,0,0,0,104,0,0,0,104,0,0,0,170,0,0,0,255,0,0,0,255,
+    0,0,0,255,88,88,91,255,121,122,125,255,132,133,135,255,143,144,146,255,154,154,156,255,164,164,166,255,173,174,175,255,
+    182,182,184,255,190,190,191,255,197,197,198,255,203,203,204,255,207,207,208,255,210,210,211,255,212,212,213,255,212,212,213,255,
+    211,211,212,255,209,210,210,255,49,49,49,255,0,0,0,255,26,26,26,255,203,203,203,255,251,251,251,255,231,231,231,255,
+    68,68,68,255,0,0,0,255,0,0,0,255,8,8,8,255,120,121,122,255,147,148,150,255,141,142,144,255,134,135,137,255,
+    128,129,131,255,121,122,125,255,115,115,118,255,108,109,112,255,101,102,105,255,93,94,97,255,81,82,84,255,65,66,68,255,
+    48,48,50,255,29,29,30,255,9,9,10,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,164,
+    0,0,0,0,0,0,0,255,1,1,1,255,154,154,154,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    210,210,210,255,72,72,72,255,70,70,70,255,196,196,196,255,202,202,202,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,215,215,215,255,179,179,179,255,71,71,71,255,209,209,209,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,116,116,116,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,5,5,5,255,
+    164,164,164,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,209,207,207,255,149,52,69,255,120,45,58,255,
+    182,182,182,255,197,197,197,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,217,217,217,255,214,171,179,255,
+    147,55,71,255,209,207,208,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,104,104,104,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,5,5,5,255,164,164,164,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,150,150,150,255,1,1,1,255,42,42,42,255,206,206,206,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,100,100,100,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,5,5,5,255,164,164,164,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,204,204,204,255,209,209,209,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,100,100,100,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,117,0,0,0,255,0,0,0,255,0,0,0,255,18,18,18,255,44,44,44,255,20,20,20,255,0,0,0,255,
+    0,0,0,255,84,85,87,255,118,119,122,255,129,130,132,255,139,140,142,255,149,150,152,255,159,159,161,255,168,168,170,255,
+    176,177,178,255,184,184,185,255,190,190,192,255,195,196,197,255,200,200,201,255,203,203,204,255,204,205,206,255,205,205,206,255,
+    204,204,205,255,184,184,185,255,0,0,0,255,0,0,0,255,136,136,136,255,254,254,254,255,254,254,254,255,254,254,254,255,
+    202,202,202,255,1,1,1,255,0,0,0,255,0,0,0,255,11,11,11,255,119,119,121,255,139,139,142,255,132,133,135,255,
+    126,127,129,255,119,120,123,255,113,114,117,255,106,107,110,255,100,101,104,255,91,92,95,255,78,79,81,255,62,63,65,255,
+    45,46,47,255,26,27,27,255,7,7,7,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,2,2,2,255,8,8,8,255,5,5,5,255,0,0,0,255,0,0,0,255,0,0,0,249,
+    0,0,0,0,0,0,0,255,1,1,1,255,153,153,153,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,151,151,151,255,33,33,33,255,178,178,178,255,192,192,192,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,224,224,224,255,105,105,105,255,150,150,150,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,114,114,114,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,5,5,5,255,
+    163,163,163,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,176,130,137,255,128,17,37,255,
+    160,159,159,255,177,177,177,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,227,227,227,255,178,96,112,255,
+    175,135,140,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,102,102,102,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,5,5,5,255,163,163,163,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,135,135,135,255,0,0,0,255,59,59,59,255,210,210,210,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,98,98,98,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,5,5,5,255,163,163,163,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,98,98,98,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,239,0,0,0,255,0,0,0,255,64,64,64,255,190,190,190,255,200,200,200,255,116,116,116,255,0,0,0,255,
+    0,0,0,255,75,76,78,255,115,116,118,255,125,126,128,255,135,136,138,255,145,145,147,255,154,154,156,255,162,163,164,255,
+    170,170,172,255,177,177,179,255,183,183,185,255,188,188,190,255,192,192,194,255,195,195,197,255,197,197,198,255,197,198,199,255,
+    197,197,198,255,154,155,156,255,0,0,0,255,0,0,0,255,154,154,154,255,254,254,254,255,254,254,254,255,254,254,254,255,
+    219,219,219,255,2,2,2,255,0,0,0,255,0,0,0,255,0,0,0,255,14,14,14,255,116,116,118,255,130,131,133,255,
+    124,124,127,255,117,118,121,255,111,112,115,255,105,106,108,255,98,99,102,255,88,89,92,255,75,75,78,255,59,59,61,255,
+    41,42,43,255,23,23,24,255,4,4,5,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,4,4,4,255,31,31,31,255,36,36,36,255,35,35,35,255,18,18,18,255,0,0,0,255,0,0,0,253,
+    0,0,0,0,0,0,0,255,1,1,1,255,152,152,152,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,202,203,203,255,44,44,44,255,131,131,131,255,189,189,189,255,208,208,208,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    208,208,208,255,222,222,222,255,70,70,70,255,204,204,204,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,110,110,110,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,4,4,4,255,
+    162,162,162,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,203,196,196,255,138,24,44,255,
+    115,94,96,255,172,173,173,255,205,205,205,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,208,206,207,255,231,222,224,255,148,51,68,255,
+    205,201,201,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,99,99,99,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,4,4,4,255,162,162,162,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,117,117,117,255,0,0,0,255,76,76,76,255,210,210,210,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,95,95,95,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,4,4,4,255,162,162,162,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,95,95,95,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,253,0,0,0,255,0,0,0,255,107,107,107,255,201,201,201,255,201,201,201,255,109,109,109,255,0,0,0,255,
+    0,0,0,255,61,62,63,255,111,112,114,255,121,122,124,255,130,131,133,255,139,140,142,255,148,149,151,255,156,157,159,255,
+    164,164,166,255,170,171,172,255,176,176,178,255,181,181,183,255,185,185,186,255,187,188,189,255,189,189,191,255,190,190,192,255,
+    190,190,191,255,162,162,163,255,0,0,0,255,0,0,0,255,60,60,60,255,243,243,243,255,254,254,254,255,252,252,252,255,
+    119,119,119,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,17,17,18,255,114,115,117,255,
+    121,122,124,255,115,116,118,255,109,110,112,255,102,103,106,255,96,97,99,255,84,85,88,255,70,71,73,255,54,55,57,255,
+    37,37,39,255,18,19,19,255,2,2,2,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,5,5,5,255,34,34,34,255,36,36,36,255,36,36,36,255,22,22,22,255,0,0,0,255,0,0,0,253,
+    0,0,0,0,0,0,0,255,1,1,1,255,150,150,150,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,141,141,141,255,78,78,78,255,173,173,173,255,185,185,185,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    128,128,128,255,88,88,88,255,155,155,155,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,107,107,107,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,4,4,4,255,
+    161,161,161,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,169,119,126,255,
+    118,50,61,255,150,150,150,255,166,166,166,255,211,211,211,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,165,110,118,255,166,79,96,255,175,137,142,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,96,96,96,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,4,4,4,255,161,161,161,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,211,211,211,255,89,89,89,255,7,7,7,255,163,163,163,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,91,91,91,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,4,4,4,255,161,161,161,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,91,91,91,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,253,0,0,0,255,0,0,0,255,10,10,10,255,94,94,94,255,131,131,131,255,64,64,64,255,0,0,0,255,
+    0,0,0,255,43,43,45,255,106,107,110,255,116,117,120,255,125,126,129,255,134,135,137,255,142,143,145,255,150,151,153,255,
+    157,158,160,255,163,164,166,255,169,169,171,255,173,174,175,255,177,177,179,255,180,180,182,255,182,182,183,255,183,183,184,255,
+    183,183,184,255,181,182,183,255,23,23,23,255,0,0,0,255,0,0,0,255,50,50,50,255,121,121,121,255,77,77,77,255,
+    3,3,3,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,24,24,25,255,
+    113,114,116,255,112,113,116,255,106,107,110,255,100,101,104,255,92,93,96,255,80,81,83,255,65,66,68,255,49,50,51,255,
+    32,32,33,255,13,13,14,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,6,6,6,255,15,15,15,255,12,12,12,255,1,1,1,255,0,0,0,255,0,0,0,252,
+    0,0,0,0,0,0,0,255,1,1,1,255,149,149,149,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,205,205,205,255,56,56,56,255,141,141,141,255,172,172,172,255,194,194,194,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,210,210,210,255,
+    84,84,84,255,96,96,96,255,211,211,211,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,103,103,103,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,4,4,4,255,
+    160,160,160,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,204,199,199,255,
+    137,33,51,255,114,102,103,255,147,147,147,255,183,183,183,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,210,209,209,255,151,66,80,255,153,77,89,255,210,210,210,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,92,92,92,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,4,4,4,255,160,160,160,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,208,208,208,255,56,56,56,255,22,22,22,255,193,193,193,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,88,88,88,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,4,4,4,255,160,160,160,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,88,88,88,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,252,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,20,21,21,255,102,103,106,255,111,112,115,255,120,121,123,255,128,129,132,255,136,137,139,255,144,144,146,255,
+    150,151,153,255,156,157,159,255,161,162,164,255,166,166,168,255,169,170,172,255,172,173,174,255,174,175,176,255,175,175,177,255,
+    175,176,177,255,175,175,177,255,106,106,107,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    37,37,38,255,109,110,112,255,103,104,107,255,97,98,101,255,87,88,91,255,74,75,77,255,60,60,62,255,43,44,45,255,
+    26,26,27,255,8,8,8,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,187,
+    0,0,0,0,0,0,0,255,1,1,1,255,148,148,148,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,159,159,159,255,67,67,67,255,160,160,160,255,161,161,161,255,190,190,190,255,
+    211,211,211,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,155,155,155,255,
+    30,30,30,255,185,185,185,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,99,99,99,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,4,4,4,255,
+    159,159,159,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    177,138,143,255,132,45,59,255,129,127,128,255,126,126,126,255,176,176,176,255,211,211,211,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,176,139,144,255,136,16,38,255,190,173,175,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,88,88,88,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,4,4,4,255,159,159,159,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,203,203,203,255,155,155,155,255,120,120,120,255,102,102,102,255,
+    94,94,94,255,97,97,97,255,105,105,105,255,111,111,111,255,17,17,17,255,28,28,28,255,161,161,161,255,189,189,189,255,
+    206,206,206,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,84,84,84,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,4,4,4,255,159,159,159,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,203,203,203,255,192,192,192,255,208,208,208,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,84,84,84,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,202,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,1,1,1,255,90,91,94,255,106,107,110,255,114,115,118,255,122,123,126,255,130,131,133,255,137,138,140,255,
+    143,144,146,255,149,150,152,255,154,155,157,255,158,159,161,255,162,162,164,255,164,165,167,255,166,167,169,255,167,168,170,255,
+    168,168,170,255,168,168,170,255,167,167,169,255,73,74,74,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,74,74,76,255,100,101,104,255,93,94,97,255,82,82,85,255,68,69,71,255,53,53,55,255,36,37,38,255,
+    19,19,20,255,3,3,3,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,221,0,0,0,191,0,0,0,191,0,0,0,189,0,0,0,149,0,0,0,18,
+    0,0,0,0,0,0,0,255,1,1,1,255,148,148,148,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,211,211,211,255,103,103,103,255,77,77,77,255,157,157,157,255,153,153,153,255,
+    167,167,167,255,185,185,185,255,205,205,205,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,162,162,162,255,41,41,41,255,
+    149,149,149,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,95,95,95,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,4,4,4,255,
+    158,158,158,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    211,210,210,255,156,78,91,255,135,57,71,255,124,119,119,255,110,110,110,255,135,135,135,255,167,167,167,255,201,201,201,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,211,211,211,255,179,148,152,255,138,25,45,255,173,131,137,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,85,85,85,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,4,4,4,255,158,158,158,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,210,210,210,255,86,86,86,255,8,8,8,255,87,88,88,255,120,121,121,255,
+    144,144,144,255,140,140,140,255,126,126,126,255,64,64,64,255,0,0,0,255,12,12,12,255,37,37,37,255,99,99,99,255,
+    92,92,92,255,89,89,89,255,138,138,138,255,203,203,203,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,80,80,80,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,4,4,4,255,158,158,158,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,211,211,211,255,145,145,145,255,28,28,28,255,6,6,6,255,44,44,44,255,
+    176,176,176,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,80,80,80,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,38,0,0,0,198,0,0,0,242,0,0,0,243,0,0,0,242,0,0,0,247,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,59,59,61,255,100,101,104,255,109,109,112,255,116,117,120,255,124,124,127,255,130,131,134,255,
+    136,137,140,255,142,143,145,255,147,147,150,255,151,152,154,255,154,155,157,255,157,158,159,255,159,159,161,255,160,161,162,255,
+    161,161,163,255,160,161,163,255,160,160,162,255,159,159,161,255,108,108,109,255,11,11,12,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,41,41,42,255,96,97,100,255,87,88,90,255,75,75,78,255,61,61,63,255,45,46,47,255,29,29,30,255,
+    11,11,12,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,95,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,255,1,1,1,255,146,146,146,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,207,207,207,255,99,99,99,255,44,44,44,255,113,113,113,255,
+    150,150,150,255,148,148,148,255,180,180,180,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,208,208,208,255,142,142,142,255,59,59,59,255,157,157,157,255,
+    211,211,211,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,91,91,91,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,3,3,3,255,
+    158,158,158,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,206,202,202,255,154,76,89,255,137,31,50,255,132,85,93,255,121,111,111,255,114,106,106,255,166,161,162,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,208,206,206,255,171,125,132,255,140,38,55,255,177,140,145,255,211,210,210,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,81,81,81,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,3,3,3,255,158,158,158,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,152,152,152,255,29,29,29,255,64,64,64,255,140,141,141,255,
+    176,177,177,255,201,201,201,255,211,211,211,255,112,112,112,255,1,1,1,255,75,75,75,255,203,203,203,255,210,210,210,255,
+    210,210,210,255,192,192,192,255,96,96,96,255,58,58,58,255,196,196,196,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,76,76,76,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,3,3,3,255,158,158,158,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,187,187,187,255,17,17,17,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    65,65,65,255,209,209,209,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,76,76,76,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,102,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,22,22,23,255,94,94,97,255,103,104,106,255,110,111,114,255,117,118,121,255,124,124,127,255,
+    130,130,133,255,135,136,138,255,140,140,142,255,143,144,146,255,147,147,150,255,149,150,152,255,151,152,154,255,153,153,155,255,
+    153,154,156,255,153,154,156,255,153,153,155,255,152,152,154,255,150,151,153,255,128,129,131,255,27,27,28,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,30,31,31,255,91,92,94,255,80,81,83,255,67,68,70,255,52,53,55,255,37,37,39,255,21,21,21,255,
+    4,4,4,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,255,1,1,1,255,142,142,142,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,209,209,209,255,156,156,156,255,64,64,64,255,
+    29,29,29,255,32,32,32,255,44,44,44,255,113,113,113,255,158,158,158,255,186,186,186,255,202,202,202,255,208,208,208,255,
+    209,209,209,255,208,208,208,255,198,199,199,255,168,168,168,255,100,100,100,255,88,88,88,255,189,189,189,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,87,87,87,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,2,2,2,255,
+    154,154,154,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,209,207,207,255,177,137,143,255,145,44,62,255,135,16,38,255,134,19,40,255,140,34,53,255,
+    161,102,112,255,180,148,153,255,193,179,180,255,202,198,198,255,207,206,206,255,208,208,208,255,207,205,205,255,199,193,193,255,
+    183,157,160,255,151,77,87,255,148,65,78,255,194,179,181,255,212,211,211,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,77,77,77,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,2,2,2,255,154,154,154,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,193,193,193,255,127,127,127,255,68,68,68,255,
+    57,57,57,255,87,88,88,255,132,132,132,255,157,157,157,255,138,138,138,255,172,172,172,255,201,201,201,255,200,200,200,255,
+    196,196,196,255,178,178,178,255,105,105,105,255,40,40,40,255,187,187,187,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,72,72,72,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,2,2,2,255,154,154,154,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,169,169,169,255,1,1,1,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    52,52,52,255,208,208,208,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,72,72,72,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,87,0,0,0,230,
+    0,0,0,255,0,0,0,255,0,0,0,255,68,69,71,255,96,97,100,255,104,105,107,255,110,111,114,255,117,117,120,255,
+    122,123,126,255,127,128,131,255,132,133,135,255,136,137,139,255,139,140,142,255,142,142,145,255,144,144,146,255,145,146,148,255,
+    146,146,148,255,146,146,149,255,145,146,148,255,144,145,147,255,143,144,146,255,141,142,144,255,135,136,138,255,61,62,63,255,
+    1,1,1,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,36,36,37,255,83,84,86,255,71,72,74,255,58,58,60,255,43,44,45,255,28,28,29,255,11,11,12,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,254,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,255,0,0,0,255,136,136,136,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,208,208,208,255,
+    174,174,174,255,39,39,39,255,9,9,9,255,3,3,3,255,4,4,4,255,13,13,13,255,29,29,29,255,44,44,44,255,
+    52,52,52,255,48,48,48,255,49,49,49,255,89,89,89,255,172,172,172,255,207,207,207,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,82,82,82,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,1,1,1,255,
+    149,149,149,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,207,204,204,255,184,157,160,255,140,24,45,255,136,3,29,255,
+    136,0,27,255,136,2,28,255,136,9,34,255,139,22,44,255,141,35,54,255,141,40,58,255,141,35,54,255,139,32,51,255,
+    151,68,81,255,184,157,160,255,207,203,204,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,72,72,72,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,1,1,1,255,149,149,149,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,209,209,209,255,
+    192,192,192,255,161,161,161,255,125,125,125,255,102,102,102,255,93,93,93,255,92,92,92,255,95,95,95,255,100,100,100,255,
+    103,103,103,255,110,110,110,255,141,141,141,255,191,191,191,255,211,211,211,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,68,68,68,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,1,1,1,255,149,149,149,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,202,202,202,255,53,53,53,255,0,0,0,255,0,0,0,255,12,12,12,255,
+    144,144,144,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,68,68,68,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,157,
+    0,0,0,255,0,0,0,255,0,0,0,255,24,24,25,255,86,86,89,255,97,98,101,255,104,105,107,255,110,111,113,255,
+    115,116,119,255,120,121,124,255,125,125,128,255,128,129,132,255,132,132,135,255,134,135,137,255,136,137,139,255,137,138,140,255,
+    138,139,141,255,138,139,141,255,138,139,141,255,137,138,140,255,136,137,139,255,135,135,138,255,132,133,136,255,130,131,133,255,
+    98,99,101,255,22,22,22,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    1,1,1,255,65,66,68,255,74,75,77,255,62,62,64,255,48,48,50,255,33,34,35,255,18,18,18,255,3,3,3,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,214,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,255,0,0,0,255,130,130,130,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,195,195,195,255,180,180,180,255,166,166,166,255,149,149,149,255,135,135,135,255,127,127,127,255,128,128,128,255,
+    139,139,139,255,162,162,162,255,193,193,193,255,210,210,210,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,73,73,73,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,
+    144,144,144,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,211,211,211,255,199,186,188,255,190,167,171,255,
+    183,150,155,255,176,132,138,255,170,117,125,255,168,109,118,255,168,109,119,255,171,121,128,255,181,146,151,255,197,183,184,255,
+    209,208,208,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,64,64,64,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,144,144,144,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,210,210,210,255,209,209,209,255,208,208,208,255,208,208,208,255,
+    210,210,210,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,60,60,60,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,0,0,0,255,144,144,144,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,196,196,196,255,126,126,126,255,109,109,109,255,165,165,165,255,
+    210,210,210,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,60,60,60,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,80,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,55,56,58,255,86,87,90,255,96,97,100,255,103,104,107,255,
+    108,109,112,255,113,114,117,255,117,118,121,255,121,122,124,255,124,125,127,255,127,127,130,255,129,129,132,255,130,131,133,255,
+    131,132,134,255,131,132,134,255,131,132,134,255,130,131,134,255,129,130,133,255,128,129,131,255,126,127,129,255,124,124,127,255,
+    121,122,124,255,116,117,120,255,68,68,70,255,12,13,13,255,0,0,0,255,0,0,0,255,0,0,0,255,3,3,3,255,
+    51,52,53,255,76,76,79,255,64,65,67,255,51,52,53,255,37,38,39,255,22,23,23,255,7,7,8,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,139,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,255,0,0,0,255,123,123,123,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,211,211,211,255,211,211,211,255,
+    211,211,211,255,211,211,211,255,211,211,211,255,211,211,211,255,210,210,210,255,210,210,210,255,211,211,211,255,211,211,211,255,
+    211,211,211,255,211,211,211,255,211,211,211,255,211,211,211,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,211,211,211,255,63,63,63,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,
+    138,138,138,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,211,211,211,255,211,211,211,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,211,211,211,255,54,54,54,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,138,138,138,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,211,211,211,255,211,211,211,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,211,211,211,255,50,50,50,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,0,0,0,255,138,138,138,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,211,211,211,255,211,211,211,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    211,211,211,255,50,50,50,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,
+    0,0,0,238,0,0,0,255,0,0,0,255,0,0,0,255,9,9,9,255,69,69,71,255,85,86,89,255,95,96,99,255,
+    101,102,105,255,105,106,109,255,110,111,113,255,113,114,117,255,116,117,120,255,119,120,122,255,121,122,124,255,122,123,126,255,
+    123,124,127,255,124,125,127,255,124,125,127,255,123,124,127,255,122,123,126,255,121,122,124,255,119,120,123,255,117,118,121,255,
+    115,116,118,255,112,113,115,255,109,110,113,255,103,104,107,255,70,70,72,255,44,44,46,255,46,47,48,255,74,75,77,255,
+    75,76,78,255,65,65,67,255,53,53,55,255,40,40,41,255,26,26,27,255,11,11,11,255,1,1,1,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,47,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,255,0,0,0,255,117,117,117,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    211,211,211,255,211,211,211,255,210,210,210,255,207,207,207,255,204,204,204,255,202,202,202,255,199,199,199,255,190,190,190,255,
+    181,181,181,255,171,171,171,255,160,160,160,255,148,148,148,255,134,134,134,255,125,125,125,255,113,113,113,255,102,102,102,255,
+    93,93,93,255,86,86,86,255,81,81,81,255,78,78,78,255,76,76,76,255,76,76,76,255,78,78,78,255,82,82,82,255,
+    88,88,88,255,96,96,96,255,105,105,105,255,116,116,116,255,127,127,127,255,136,136,136,255,149,149,149,255,160,160,160,255,
+    171,171,171,255,179,179,179,255,51,51,51,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,
+    131,131,131,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,211,211,211,255,
+    209,209,209,255,207,207,207,255,205,205,205,255,203,203,203,255,195,195,195,255,187,187,187,255,178,178,178,255,169,169,169,255,
+    157,157,157,255,144,144,144,255,135,135,135,255,123,123,123,255,113,113,113,255,105,105,105,255,98,98,98,255,93,93,93,255,
+    90,90,90,255,89,89,89,255,89,89,89,255,91,91,91,255,95,95,95,255,101,101,101,255,109,109,109,255,118,118,118,255,
+    128,128,128,255,139,139,139,255,148,148,148,255,160,160,160,255,170,170,170,255,179,179,179,255,185,185,185,255,45,45,45,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,131,131,131,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,211,211,211,255,209,209,209,255,207,207,207,255,205,205,205,255,
+    202,202,202,255,195,195,195,255,187,187,187,255,178,178,178,255,169,169,169,255,157,157,157,255,144,144,144,255,135,135,135,255,
+    123,123,123,255,113,113,113,255,105,105,105,255,98,98,98,255,93,93,93,255,90,90,90,255,89,89,89,255,89,89,89,255,
+    91,91,91,255,95,95,95,255,101,101,101,255,109,109,109,255,118,118,118,255,128,128,128,255,139,139,139,255,148,148,148,255,
+    160,160,160,255,170,170,170,255,179,179,179,255,185,185,185,255,41,41,41,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,0,0,0,255,131,131,131,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,212,212,212,255,
+    212,212,212,255,211,211,211,255,209,209,209,255,207,207,207,255,205,205,205,255,202,202,202,255,195,195,195,255,187,187,187,255,
+    178,178,178,255,169,169,169,255,157,157,157,255,144,144,144,255,135,135,135,255,123,123,123,255,113,113,113,255,105,105,105,255,
+    98,98,98,255,93,93,93,255,90,90,90,255,89,89,89,255,89,89,89,255,91,91,91,255,95,95,95,255,101,101,101,255,
+    109,109,109,255,118,118,118,255,128,128,128,255,139,139,139,255,148,148,148,255,160,160,160,255,170,170,170,255,179,179,179,255,
+    185,185,185,255,41,41,41,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,147,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,22,22,23,255,70,70,73,255,82,83,86,255,
+    92,93,95,255,98,99,102,255,102,103,106,255,106,107,109,255,109,110,112,255,111,112,115,255,113,114,117,255,115,116,118,255,
+    116,117,119,255,116,117,120,255,116,117,120,255,116,117,120,255,115,116,119,255,114,115,118,255,113,113,116,255,111,111,114,255,
+    108,109,112,255,106,107,109,255,103,104,107,255,100,101,103,255,96,97,100,255,90,91,94,255,83,83,86,255,74,74,77,255,
+    63,64,66,255,52,53,54,255,40,40,42,255,27,27,28,255,13,13,13,255,2,2,2,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,203,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,255,0,0,0,255,92,92,92,255,163,163,163,255,151,151,151,255,138,138,138,255,124,124,124,255,
+    108,108,108,255,91,91,91,255,77,77,77,255,68,68,68,255,55,55,55,255,41,41,41,255,27,27,27,255,20,20,20,255,
+    18,18,18,255,12,12,12,255,5,5,5,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,1,1,1,255,5,5,5,255,
+    12,12,12,255,17,17,17,255,5,5,5,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,
+    108,108,108,255,172,172,172,255,160,160,160,255,148,148,148,255,135,135,135,255,119,119,119,255,103,103,103,255,89,89,89,255,
+    79,79,79,255,65,65,65,255,50,50,50,255,36,36,36,255,28,28,28,255,25,25,25,255,17,17,17,255,9,9,9,255,
+    3,3,3,255,2,2,2,255,2,2,2,255,2,2,2,255,1,1,1,255,1,1,1,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,1,1,1,255,1,1,1,255,
+    2,2,2,255,2,2,2,255,3,3,3,255,4,4,4,255,10,10,10,255,18,18,18,255,25,25,25,255,6,6,6,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,108,108,108,255,172,172,172,255,160,160,160,255,
+    148,148,148,255,134,134,134,255,119,119,119,255,103,103,103,255,89,89,89,255,79,79,79,255,65,65,65,255,50,50,50,255,
+    36,36,36,255,28,28,28,255,25,25,25,255,17,17,17,255,9,9,9,255,3,3,3,255,2,2,2,255,2,2,2,255,
+    2,2,2,255,1,1,1,255,1,1,1,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,1,1,1,255,1,1,1,255,2,2,2,255,2,2,2,255,3,3,3,255,
+    4,4,4,255,10,10,10,255,18,18,18,255,25,25,25,255,6,6,6,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,0,0,0,255,108,108,108,255,172,172,172,255,160,160,160,255,148,148,148,255,134,134,134,255,119,119,119,255,
+    103,103,103,255,89,89,89,255,79,79,79,255,65,65,65,255,50,50,50,255,36,36,36,255,28,28,28,255,25,25,25,255,
+    17,17,17,255,9,9,9,255,3,3,3,255,2,2,2,255,2,2,2,255,2,2,2,255,1,1,1,255,1,1,1,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    1,1,1,255,1,1,1,255,2,2,2,255,2,2,2,255,3,3,3,255,4,4,4,255,10,10,10,255,18,18,18,255,
+    25,25,25,255,6,6,6,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,35,0,0,0,251,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,30,30,31,255,66,67,69,255,
+    77,78,81,255,87,88,90,255,94,95,97,255,98,99,102,255,101,102,105,255,104,105,108,255,106,107,110,255,107,108,111,255,
+    108,109,112,255,109,110,113,255,109,110,113,255,109,110,113,255,108,109,112,255,107,108,111,255,106,107,110,255,104,105,108,255,
+    102,103,106,255,99,100,103,255,96,97,100,255,92,93,96,255,86,87,90,255,79,80,82,255,70,71,73,255,61,62,64,255,
+    51,51,53,255,39,40,41,255,27,27,28,255,14,14,14,255,2,2,2,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,89,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,255,0,0,0,255,5,5,5,255,4,4,4,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,
+    8,8,8,255,8,8,8,255,3,3,3,255,3,3,3,255,2,2,2,255,1,1,1,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,8,8,8,255,8,8,8,255,3,3,3,255,
+    3,3,3,255,2,2,2,255,1,1,1,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,0,0,0,255,8,8,8,255,8,8,8,255,3,3,3,255,3,3,3,255,2,2,2,255,1,1,1,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,161,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,30,30,31,255,
+    60,61,63,255,71,71,74,255,80,80,83,255,87,88,90,255,92,93,96,255,96,97,100,255,98,99,102,255,100,101,104,255,
+    101,102,105,255,101,102,105,255,102,103,106,255,102,103,105,255,101,102,105,255,100,101,104,255,99,100,103,255,97,98,101,255,
+    95,96,98,255,91,92,95,255,86,87,90,255,80,81,84,255,73,74,77,255,66,66,68,255,57,57,59,255,47,48,49,255,
+    36,37,38,255,25,25,26,255,13,13,13,255,2,2,2,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,214,0,0,0,3,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,0,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,26,0,0,0,242,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    22,22,23,255,52,52,54,255,62,62,64,255,70,71,73,255,77,78,80,255,82,83,86,255,86,87,90,255,89,90,93,255,
+    92,92,95,255,93,94,96,255,93,94,97,255,93,94,97,255,92,93,96,255,91,92,95,255,89,90,93,255,86,87,90,255,
+    82,83,86,255,78,79,81,255,72,73,75,255,66,67,69,255,59,59,61,255,51,51,53,255,42,42,44,255,32,32,33,255,
+    21,21,22,255,10,10,10,255,1,1,1,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,90,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,154,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,12,12,13,255,40,41,42,255,51,52,53,255,59,60,61,255,65,66,68,255,70,71,73,255,74,75,77,255,
+    77,77,80,255,78,79,82,255,79,80,83,255,79,80,83,255,79,79,82,255,77,78,80,255,75,75,78,255,71,72,74,255,
+    68,68,70,255,63,63,65,255,57,58,59,255,50,51,52,255,43,43,45,255,35,35,36,255,26,26,27,255,16,16,16,255,
+    6,6,6,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,180,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,32,0,0,0,248,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,3,3,4,255,24,24,24,255,39,39,41,255,46,46,48,255,51,52,53,255,56,56,58,255,
+    59,59,61,255,61,62,63,255,62,63,65,255,62,63,65,255,62,62,64,255,60,61,63,255,58,58,60,255,55,55,57,255,
+    51,51,53,255,46,46,48,255,40,40,42,255,33,34,35,255,26,26,27,255,18,18,19,255,9,9,9,255,2,2,2,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,157,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,53,0,0,0,250,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,6,6,6,255,20,20,21,255,30,31,31,255,35,35,36,255,
+    39,39,40,255,41,42,43,255,43,43,44,255,43,44,45,255,43,43,44,255,41,42,43,255,39,39,41,255,36,36,37,255,
+    32,32,33,255,27,27,28,255,21,22,22,255,15,15,15,255,8,8,8,255,2,2,2,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,10,10,10,255,15,15,15,255,7,7,7,213,0,0,0,23,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,39,0,0,0,238,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,3,3,3,255,10,10,10,255,
+    16,17,17,255,20,21,21,255,22,22,23,255,23,23,24,255,22,23,23,255,21,22,22,255,19,19,20,255,16,16,17,255,
+    12,13,13,255,8,8,8,255,4,4,4,255,1,1,1,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,17,17,17,255,20,20,20,255,19,19,19,255,4,4,4,213,
+    0,0,0,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,23,0,0,0,223,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,1,1,1,255,3,3,3,255,3,3,4,255,3,3,4,255,3,3,3,255,2,2,2,255,1,1,1,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,9,9,9,255,20,20,20,255,20,20,20,255,6,6,6,255,
+    0,0,0,209,0,0,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,
+    0,0,0,205,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,5,5,5,255,6,6,6,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,6,6,6,255,8,8,8,255,1,1,1,255,
+    0,0,0,255,0,0,0,65,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,104,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,4,4,4,255,21,21,21,255,21,21,21,255,2,2,2,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,119,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,6,6,6,255,21,21,21,255,14,14,14,255,0,0,0,255,
+    0,0,0,255,0,0,0,242,0,0,0,250,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,168,0,0,0,109,
+    0,0,0,172,0,0,0,113,0,0,0,253,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,167,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,
+    0,0,0,238,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,3,3,3,255,0,0,0,247,0,0,0,84,
+    0,0,0,143,0,0,0,43,0,0,0,46,0,0,0,189,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,216,0,0,0,76,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,100,0,0,0,253,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,180,
+    0,0,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,45,0,0,0,231,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,253,0,0,0,80,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,63,0,0,0,184,0,0,0,254,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,208,0,0,0,91,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,92,0,0,0,243,0,0,0,254,0,0,0,171,0,0,0,7,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,35,0,0,0,220,0,0,0,255,0,0,0,252,0,0,0,103,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,0,0,132,
+    0,0,0,215,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,231,
+    0,0,0,151,0,0,0,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,20,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,64,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,33,0,0,0,94,0,0,0,145,0,0,0,238,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,109,0,0,0,2,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,169,0,0,0,255,0,0,0,255,0,0,0,255,
+    2,2,2,255,24,24,24,255,8,8,8,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,50,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,145,0,0,0,255,0,0,0,255,
+    12,12,12,255,40,40,40,255,25,25,25,255,0,0,0,255,0,0,0,226,0,0,0,66,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,93,0,0,0,255,0,0,0,255,
+    16,16,16,255,40,40,40,255,29,29,29,255,0,0,0,255,0,0,0,213,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,93,0,0,0,255,0,0,0,255,
+    11,11,11,255,40,40,40,255,24,24,24,255,0,0,0,255,0,0,0,213,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,92,0,0,0,255,0,0,0,255,
+    1,1,1,255,23,23,23,255,7,7,7,255,0,0,0,255,0,0,0,213,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,254,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,171,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,116,0,0,0,241,
+    0,0,0,252,0,0,0,252,0,0,0,251,0,0,0,200,0,0,0,31,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,2,2,1,21,
+    8,8,4,33,5,5,2,41,0,0,0,53,0,0,0,66,0,0,0,66,1,1,0,53,5,5,3,41,8,8,4,33,
+    2,2,1,21,0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,
+    2,2,1,21,8,8,4,33,5,5,2,41,0,0,0,53,0,0,0,66,0,0,0,66,1,1,0,53,5,5,3,41,
+    8,8,4,33,2,2,1,21,0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,7,2,2,1,21,8,8,4,33,5,5,2,41,0,0,0,53,0,0,0,66,0,0,0,66,1,1,0,53,
+    5,5,3,41,8,8,4,33,2,2,1,21,0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,7,2,2,1,21,8,8,4,33,5,5,2,41,0,0,0,53,0,0,0,66,0,0,0,66,
+    1,1,0,53,5,5,3,41,8,8,4,33,2,2,1,21,0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,27,6,6,2,67,2,2,1,113,26,26,14,168,
+    51,51,26,217,59,59,30,245,64,64,33,255,68,68,36,255,68,68,36,255,64,64,33,254,59,59,31,244,51,51,27,216,
+    26,26,14,168,2,2,1,112,6,6,3,66,0,0,0,26,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,27,6,6,2,67,2,2,1,113,
+    26,26,14,168,51,51,26,217,59,59,30,245,64,64,33,255,68,68,36,255,68,68,36,255,64,64,33,254,59,59,31,244,
+    51,51,27,216,26,26,14,168,2,2,1,112,6,6,3,66,0,0,0,26,0,0,0,3,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,27,6,6,2,67,
+    2,2,1,113,26,26,14,168,51,51,26,217,59,59,30,245,64,64,33,255,68,68,36,255,68,68,36,255,64,64,33,254,
+    59,59,31,244,51,51,27,216,26,26,14,168,2,2,1,112,6,6,3,66,0,0,0,26,0,0,0,3,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,27,
+    6,6,2,67,2,2,1,113,26,26,14,168,51,51,26,217,59,59,30,245,64,64,33,255,68,68,36,255,68,68,36,255,
+    64,64,33,254,59,59,31,244,51,51,27,216,26,26,14,168,2,2,1,112,6,6,3,66,0,0,0,26,0,0,0,3,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,3,3,2,26,3,3,2,100,17,17,9,165,62,62,32,225,103,103,54,253,143,143,74,251,
+    174,174,90,255,196,196,101,255,211,211,110,255,218,218,114,255,218,218,114,255,211,211,110,255,196,196,102,255,174,174,90,255,
+    142,142,74,251,103,103,53,253,61,61,32,225,16,16,9,164,3,3,2,99,3,3,2,25,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,3,3,2,26,3,3,2,100,17,17,9,165,62,62,32,225,103,103,54,253,
+    143,143,74,251,174,174,90,255,196,196,101,255,211,211,110,255,218,218,114,255,218,218,114,255,211,211,110,255,196,196,102,255,
+    174,174,90,255,142,142,74,251,103,103,53,253,61,61,32,225,16,16,9,164,3,3,2,99,3,3,2,25,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,3,2,26,3,3,2,100,17,17,9,165,62,62,32,225,
+    103,103,54,253,143,143,74,251,174,174,90,255,196,196,101,255,211,211,110,255,218,218,114,255,218,218,114,255,211,211,110,255,
+    196,196,102,255,174,174,90,255,142,142,74,251,103,103,53,253,61,61,32,225,16,16,9,164,3,3,2,99,3,3,2,25,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,3,2,26,3,3,2,100,17,17,9,165,
+    62,62,32,225,103,103,54,253,143,143,74,251,174,174,90,255,196,196,101,255,211,211,110,255,218,218,114,255,218,218,114,255,
+    211,211,110,255,196,196,102,255,174,174,90,255,142,142,74,251,103,103,53,253,61,61,32,225,16,16,9,164,3,3,2,99,
+    3,3,2,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,2,2,2,0,67,11,11,6,183,68,68,36,231,142,142,74,253,189,189,98,254,221,221,115,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,221,221,115,255,189,189,98,254,142,142,74,253,68,68,35,230,11,11,6,181,2,2,0,66,0,0,0,2,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,2,2,2,0,67,11,11,6,183,68,68,36,231,142,142,74,253,189,189,98,254,221,221,115,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,221,221,115,255,189,189,98,254,142,142,74,253,68,68,35,230,11,11,6,181,2,2,0,66,
+    0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,2,2,2,0,67,11,11,6,183,68,68,36,231,142,142,74,253,189,189,98,254,
+    221,221,115,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,221,221,115,255,189,189,98,254,142,142,74,253,68,68,35,230,11,11,6,181,
+    2,2,0,66,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,2,0,67,11,11,6,183,68,68,36,231,142,142,74,253,
+    189,189,98,254,221,221,115,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,221,221,115,255,189,189,98,254,142,142,74,253,68,68,35,230,
+    11,11,6,181,2,2,0,66,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,
+    7,7,4,120,14,14,7,218,139,139,72,254,208,208,108,254,226,226,117,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,226,226,117,255,208,208,108,254,138,138,71,254,13,13,7,217,7,7,4,119,
+    0,0,0,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,12,7,7,4,120,14,14,7,218,139,139,72,254,208,208,108,254,226,226,117,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,226,226,117,255,208,208,108,254,138,138,71,254,13,13,7,217,
+    7,7,4,119,0,0,0,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,12,7,7,4,120,14,14,7,218,139,139,72,254,208,208,108,254,226,226,117,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,226,226,117,255,208,208,108,254,138,138,71,254,
+    13,13,7,217,7,7,4,119,0,0,0,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,12,7,7,4,120,14,14,7,218,139,139,72,254,208,208,108,254,226,226,117,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,226,226,117,255,208,208,108,254,
+    138,138,71,254,13,13,7,217,7,7,4,119,0,0,0,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,1,1,1,36,16,16,8,164,
+    65,65,34,247,193,193,100,254,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,192,192,100,254,64,64,34,247,
+    16,16,8,162,2,2,1,35,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,1,1,1,36,
+    16,16,8,164,65,65,34,247,193,193,100,254,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,192,192,100,254,
+    64,64,34,247,16,16,8,162,2,2,1,35,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,
+    1,1,1,36,16,16,8,164,65,65,34,247,193,193,100,254,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    192,192,100,254,64,64,34,247,16,16,8,162,2,2,1,35,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,2,1,1,1,36,16,16,8,164,65,65,34,247,193,193,100,254,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,192,192,100,254,64,64,34,247,16,16,8,162,2,2,1,35,0,0,0,2,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,1,36,21,21,11,167,90,90,47,251,
+    200,200,104,254,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,200,200,104,255,
+    91,91,47,251,21,21,11,166,2,2,1,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,1,36,21,21,11,167,
+    90,90,47,251,200,200,104,254,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    200,200,104,255,91,91,47,251,21,21,11,166,2,2,1,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,1,36,
+    21,21,11,167,90,90,47,251,200,200,104,254,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,200,200,104,255,91,91,47,251,21,21,11,166,2,2,1,35,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    2,2,1,36,21,21,11,167,90,90,47,251,200,200,104,254,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,200,200,104,255,91,91,47,251,21,21,11,166,2,2,1,35,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,
+    255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,16,16,8,164,91,91,47,251,201,201,104,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    201,201,104,255,91,91,47,251,16,16,9,162,0,0,0,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,16,16,8,164,91,91,47,251,
+    201,201,104,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,201,201,104,255,91,91,47,251,16,16,9,162,0,0,0,11,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,16,16,8,164,
+    91,91,47,251,201,201,104,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,201,201,104,255,91,91,47,251,16,16,9,162,0,0,0,11,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,
+    16,16,8,164,91,91,47,251,201,201,104,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,201,201,104,255,91,91,47,251,16,16,9,162,0,0,0,11,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,
+    255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,6,6,4,119,65,65,34,247,200,200,104,254,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,200,200,104,254,64,64,34,247,7,7,4,118,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,6,6,4,119,65,65,34,247,200,200,104,254,
+    231,231,120,255,231,231,120,255,220,220,114,255,158,158,82,255,133,133,69,255,148,148,77,255,201,201,104,255,229,229,119,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,229,229,119,255,200,200,104,255,148,148,77,255,133,133,69,255,159,159,82,255,221,221,115,255,
+    231,231,120,255,231,231,120,255,200,200,104,254,64,64,34,247,7,7,4,118,0,0,0,1,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,6,6,4,119,65,65,34,247,
+    200,200,104,254,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,200,200,104,254,64,64,34,247,7,7,4,118,0,0,0,1,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,6,6,4,119,
+    65,65,34,247,200,200,104,254,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,200,200,104,254,64,64,34,247,7,7,4,118,0,0,0,1,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,
+    255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,2,2,0,67,14,14,7,217,193,193,100,254,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,192,192,100,254,12,12,7,216,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,0,67,14,14,7,217,193,193,100,254,231,231,120,255,
+    231,231,120,255,188,188,98,255,65,65,34,255,20,20,11,255,14,14,7,255,18,18,9,255,38,38,19,255,147,147,76,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,146,146,76,255,37,37,19,255,18,18,9,255,14,14,7,255,20,20,11,255,66,66,34,255,
+    189,189,98,255,231,231,120,255,231,231,120,255,192,192,100,254,12,12,7,216,0,0,0,64,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,0,67,14,14,7,217,193,193,100,254,
+    231,231,120,255,231,231,120,255,215,215,112,255,143,143,74,255,230,230,119,255,231,231,120,255,231,231,120,255,199,199,103,255,
+    158,158,83,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,195,195,101,255,163,163,85,255,230,230,120,255,231,231,120,255,231,231,120,255,
+    178,178,93,255,179,179,93,255,231,231,120,255,231,231,120,255,192,192,100,254,12,12,7,216,0,0,0,64,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,0,67,14,14,7,217,
+    193,193,100,254,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,192,192,100,254,12,12,7,216,0,0,0,64,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,3,3,2,26,11,11,6,183,139,139,72,254,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,229,229,119,255,197,197,102,255,173,173,90,255,188,188,97,255,220,220,114,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,220,220,114,255,187,187,97,255,173,173,90,255,197,197,102,255,230,230,119,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,137,137,72,254,11,11,6,181,2,2,1,24,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,3,3,2,26,11,11,6,183,139,139,72,254,231,231,120,255,231,231,120,255,
+    190,190,99,255,51,51,27,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,2,2,1,255,
+    165,165,86,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,163,163,85,255,1,1,1,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    52,52,27,255,192,192,99,255,231,231,120,255,231,231,120,255,137,137,72,254,11,11,6,181,2,2,1,24,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,3,2,26,11,11,6,183,139,139,72,254,231,231,120,255,
+    231,231,120,255,230,230,120,255,118,118,61,255,12,12,6,255,96,96,50,255,211,211,110,255,184,184,96,255,54,54,28,255,
+    14,14,7,255,189,189,98,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,230,230,119,255,52,52,27,255,26,26,13,255,140,140,73,255,216,216,112,255,159,159,83,255,
+    10,10,5,255,71,71,36,255,206,206,107,255,231,231,120,255,231,231,120,255,137,137,72,254,11,11,6,181,2,2,1,24,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,3,2,26,11,11,6,183,139,139,72,254,
+    219,219,114,255,204,204,106,255,203,203,105,255,204,204,106,255,204,204,106,255,204,204,106,255,204,204,106,255,204,204,106,255,
+    204,204,106,255,204,204,106,255,203,203,106,255,203,203,105,255,209,209,108,255,213,213,111,255,213,213,111,255,213,213,111,255,
+    213,213,111,255,209,209,108,255,203,203,105,255,203,203,106,255,204,204,106,255,204,204,106,255,204,204,106,255,204,204,106,255,
+    204,204,106,255,204,204,106,255,204,204,106,255,203,203,105,255,204,204,106,255,219,219,114,255,137,137,72,254,11,11,6,181,
+    2,2,1,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,3,4,4,2,100,68,68,36,231,208,208,108,254,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,189,189,98,255,34,34,18,255,6,6,3,255,23,23,12,255,135,135,70,255,223,223,116,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,223,223,116,255,134,134,70,255,23,23,12,255,6,6,3,255,34,34,18,255,190,190,99,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,207,207,108,254,66,66,35,230,2,2,1,99,0,0,0,3,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,3,4,4,2,100,68,68,36,231,208,208,108,254,231,231,120,255,227,227,118,255,
+    124,124,65,255,9,9,5,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    61,61,32,255,224,224,116,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    224,224,116,255,60,60,31,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    10,10,5,255,125,125,65,255,228,228,118,255,231,231,120,255,207,207,108,254,66,66,35,230,2,2,1,99,0,0,0,3,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,4,4,2,100,68,68,36,231,208,208,108,254,231,231,120,255,
+    231,231,120,255,231,231,120,255,207,207,108,255,88,88,46,255,13,13,7,255,78,78,41,255,63,63,33,255,22,22,12,255,
+    118,118,61,255,230,230,119,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,174,174,90,255,45,45,24,255,31,31,16,255,98,98,51,255,26,26,14,255,
+    47,47,24,255,167,167,87,255,230,230,120,255,231,231,120,255,231,231,120,255,207,207,108,254,66,66,35,230,2,2,1,99,
+    0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,4,4,2,100,68,68,36,231,192,192,100,254,
+    114,114,59,255,51,51,26,255,41,41,21,255,44,44,23,255,44,44,23,255,44,44,23,255,44,44,23,255,44,44,23,255,
+    44,44,23,255,44,44,23,255,43,43,22,255,45,45,23,255,88,88,46,255,118,118,61,255,118,118,61,255,118,118,61,255,
+    118,118,61,255,88,88,45,255,45,45,23,255,43,43,22,255,44,44,23,255,44,44,23,255,44,44,23,255,44,44,23,255,
+    44,44,23,255,44,44,23,255,44,44,23,255,41,41,21,255,51,51,26,255,114,114,59,255,191,191,100,254,66,66,35,230,
+    2,2,1,99,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,26,17,17,9,165,142,142,74,253,226,226,117,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,100,100,52,255,3,3,2,255,0,0,0,255,2,2,1,255,51,51,27,255,205,205,107,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,205,205,106,255,50,50,26,255,2,2,1,255,0,0,0,255,3,3,2,255,101,101,52,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,226,226,117,255,141,141,73,253,16,16,8,164,0,0,0,26,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,26,17,17,9,165,142,142,74,253,226,226,117,255,231,231,120,255,216,216,112,255,
+    93,93,49,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    31,31,16,255,202,202,105,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    201,201,105,255,31,31,16,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,94,94,49,255,217,217,112,255,231,231,120,255,226,226,117,255,141,141,73,253,16,16,8,164,0,0,0,26,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,17,17,9,165,142,142,74,253,226,226,117,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,209,209,108,255,61,61,32,255,1,1,0,255,9,9,5,255,111,111,58,255,
+    218,218,113,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,227,227,118,255,160,160,83,255,37,37,19,255,2,2,1,255,14,14,8,255,
+    170,170,88,255,230,230,120,255,231,231,120,255,231,231,120,255,231,231,120,255,226,226,117,255,141,141,73,253,16,16,8,164,
+    0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,17,17,9,165,124,124,64,253,109,109,57,255,
+    92,92,48,255,53,53,27,255,2,2,1,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,1,1,0,255,29,29,15,255,124,124,65,255,169,169,88,255,169,169,88,255,169,169,88,255,
+    169,169,88,255,124,124,64,255,29,29,15,255,1,1,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,2,2,1,255,54,54,28,255,95,95,49,255,109,109,56,255,121,121,63,253,
+    16,16,8,164,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,6,6,3,66,62,62,32,225,189,189,98,254,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,99,99,51,255,2,2,1,255,0,0,0,255,2,2,1,255,50,50,26,255,205,205,106,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,205,205,106,255,49,49,25,255,1,1,1,255,0,0,0,255,3,3,1,255,100,100,52,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,188,188,98,254,60,60,31,224,5,5,2,66,0,0,0,0,
+    0,0,0,0,0,0,0,0,6,6,3,66,62,62,32,225,189,189,98,254,231,231,120,255,231,231,120,255,216,216,112,255,
+    93,93,48,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    31,31,16,255,201,201,104,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    201,201,104,255,31,31,16,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,93,93,48,255,216,216,112,255,231,231,120,255,231,231,120,255,188,188,98,254,60,60,31,224,5,5,2,66,
+    0,0,0,0,0,0,0,0,0,0,0,0,6,6,3,66,62,62,32,225,189,189,98,254,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,201,201,104,255,44,44,23,255,1,1,0,255,7,7,4,255,93,93,49,255,
+    214,214,111,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,225,225,117,255,147,147,77,255,26,26,14,255,2,2,1,255,10,10,5,255,
+    150,150,78,255,230,230,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,188,188,98,254,60,60,31,224,
+    5,5,2,66,0,0,0,0,0,0,0,0,0,0,0,0,6,6,3,66,49,49,26,225,76,76,39,254,113,113,58,255,
+    207,207,107,255,126,126,65,255,4,4,2,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,1,1,1,255,67,67,35,255,208,208,108,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,208,208,108,255,67,67,35,255,1,1,1,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,0,0,0,255,4,4,2,255,126,126,65,255,208,208,108,255,116,116,60,255,73,73,38,254,
+    47,47,24,224,5,5,2,66,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,7,2,2,1,112,103,103,54,252,221,221,115,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,195,195,101,255,19,19,10,255,11,11,6,255,16,16,9,255,133,133,69,255,224,224,116,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,224,224,116,255,132,132,68,255,16,16,8,255,11,11,6,255,20,20,10,255,196,196,102,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,220,220,114,255,101,101,53,253,1,1,1,111,0,0,0,7,
+    0,0,0,0,0,0,0,7,2,2,1,112,103,103,54,252,221,221,115,255,231,231,120,255,231,231,120,255,229,229,119,255,
+    123,123,64,255,8,8,4,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    57,57,30,255,226,226,118,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    226,226,118,255,56,56,29,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    8,8,4,255,124,124,65,255,229,229,119,255,231,231,120,255,231,231,120,255,220,220,114,255,101,101,53,253,1,1,1,111,
+    0,0,0,7,0,0,0,0,0,0,0,7,2,2,1,112,103,103,54,252,221,221,115,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,201,201,104,255,63,63,33,255,14,14,7,255,99,99,51,255,78,78,41,255,13,13,7,255,
+    95,95,50,255,230,230,119,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,161,161,84,255,26,26,14,255,38,38,20,255,123,123,64,255,32,32,17,255,
+    31,31,16,255,151,151,78,255,230,230,120,255,231,231,120,255,231,231,120,255,231,231,120,255,220,220,114,255,101,101,53,253,
+    1,1,1,111,0,0,0,7,0,0,0,0,0,0,0,7,2,2,1,112,18,18,9,252,108,108,56,255,208,208,108,255,
+    231,231,120,255,189,189,98,255,60,60,31,255,3,3,1,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,26,26,13,255,151,151,79,255,230,230,119,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,230,230,119,255,150,150,78,255,26,26,13,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+    0,0,0,255,0,0,0,255,3,3,1,255,61,61,32,255,190,190,99,255,231,231,120,255,210,210,109,255,111,111,58,255,
+    17,17,9,253,1,1,1,111,0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    2,2,1,22,26,26,14,169,143,143,74,251,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,216,216,112,255,176,176,92,255,200,200,104,255,229,229,119,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,229,229,119,255,200,200,104,255,176,176,92,255,216,216,112,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,141,141,74,251,25,25,13,166,2,2,1,21,
+    0,0,0,0,2,2,1,22,26,26,14,169,143,143,74,251,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    196,196,102,255,67,67,35,255,4,4,2,255,0,0,0,255,0,0,0,255,0,0,0,255,1,1,0,255,17,17,9,255,
+    175,175,91,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,173,173,89,255,17,17,8,255,1,1,0,255,0,0,0,255,0,0,0,255,0,0,0,255,4,4,2,255,
+    68,68,35,255,197,197,102,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,141,141,74,251,25,25,13,166,
+    2,2,1,21,0,0,0,0,2,2,1,22,26,26,14,169,143,143,74,251,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,230,230,120,255,121,121,63,255,26,26,14,255,132,132,68,255,230,230,119,255,207,207,108,255,86,86,44,255,
+    26,26,13,255,189,189,98,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,230,230,119,255,58,58,30,255,50,50,26,255,171,171,89,255,230,230,120,255,191,191,99,255,
+    35,35,18,255,76,76,39,255,206,206,107,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,141,141,74,251,
+    25,25,13,166,2,2,1,21,0,0,0,0,2,2,1,24,9,9,5,181,100,100,52,255,215,215,112,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,178,178,93,255,65,65,34,255,12,12,6,255,1,1,1,255,2,2,1,255,2,2,1,255,
+    5,5,3,255,32,32,16,255,145,145,76,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,143,143,74,255,31,31,16,255,5,5,3,255,2,2,1,255,2,2,1,255,
+    1,1,1,255,12,12,6,255,67,67,35,255,179,179,93,255,231,231,120,255,231,231,120,255,231,231,120,255,215,215,112,255,
+    100,100,52,255,9,9,5,179,1,1,1,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,
+    255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    8,8,4,33,51,51,26,217,174,174,90,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,173,173,90,255,50,50,26,215,8,8,4,33,
+    0,0,0,0,8,8,4,33,51,51,26,217,174,174,90,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,181,181,94,255,78,78,40,255,27,27,14,255,14,14,8,255,22,22,12,255,52,52,27,255,141,141,73,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,140,140,73,255,51,51,27,255,22,22,12,255,14,14,8,255,27,27,14,255,78,78,40,255,
+    182,182,94,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,173,173,90,255,50,50,26,215,
+    8,8,4,33,0,0,0,0,8,8,4,33,51,51,26,217,174,174,90,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,219,219,113,255,161,161,83,255,230,230,119,255,231,231,120,255,231,231,120,255,205,205,107,255,
+    173,173,90,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,202,202,105,255,177,177,92,255,230,230,120,255,231,231,120,255,231,231,120,255,
+    188,188,98,255,190,190,99,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,173,173,90,255,
+    50,50,26,215,8,8,4,33,0,0,0,0,8,8,4,33,48,48,25,217,170,170,88,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,203,203,105,255,121,121,62,255,74,74,39,255,69,69,36,255,72,72,38,255,
+    97,97,50,255,175,175,91,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,175,175,91,255,96,96,50,255,72,72,37,255,69,69,36,255,
+    74,74,39,255,121,121,63,255,203,203,105,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    169,169,88,255,47,47,24,215,8,8,4,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,
+    255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    5,5,2,42,59,59,31,245,196,196,102,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,195,195,101,255,59,59,31,244,5,5,3,41,
+    0,0,0,0,5,5,2,42,59,59,31,245,196,196,102,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,211,211,110,255,157,157,81,255,137,137,71,255,149,149,77,255,192,192,100,255,227,227,118,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,227,227,118,255,192,192,100,255,149,149,77,255,137,137,71,255,157,157,81,255,212,212,110,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,195,195,101,255,59,59,31,244,
+    5,5,3,41,0,0,0,0,5,5,2,42,59,59,31,245,196,196,102,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,195,195,101,255,
+    59,59,31,244,5,5,3,41,0,0,0,0,5,5,2,42,59,59,31,245,196,196,102,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,218,218,114,255,204,204,106,255,213,213,111,255,
+    228,228,118,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,228,228,118,255,213,213,111,255,204,204,106,255,
+    218,218,114,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    195,195,101,255,59,59,31,244,5,5,3,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,
+    255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,53,64,64,33,255,211,211,109,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,210,210,109,255,64,64,33,254,1,1,0,52,
+    0,0,0,0,0,0,0,53,64,64,33,255,211,211,109,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,210,210,109,255,64,64,33,254,
+    1,1,0,52,0,0,0,0,0,0,0,53,64,64,33,255,211,211,109,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,210,210,109,255,
+    64,64,33,254,1,1,0,52,0,0,0,0,0,0,0,53,64,64,33,255,211,211,109,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    210,210,109,255,64,64,33,254,1,1,0,52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,66,68,68,36,255,218,218,114,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,218,218,113,255,68,68,35,255,0,0,0,65,
+    0,0,0,0,0,0,0,66,68,68,36,255,218,218,114,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,218,218,113,255,68,68,35,255,
+    0,0,0,65,0,0,0,0,0,0,0,66,68,68,36,255,218,218,114,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,218,218,113,255,
+    68,68,35,255,0,0,0,65,0,0,0,0,0,0,0,66,68,68,36,255,218,218,114,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    218,218,113,255,68,68,35,255,0,0,0,65,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,66,68,68,36,255,218,218,114,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,218,218,113,255,68,68,35,255,0,0,0,65,
+    0,0,0,0,0,0,0,66,68,68,36,255,218,218,114,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,221,221,115,255,199,199,103,255,172,172,90,255,173,173,90,255,199,199,104,255,221,221,115,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,218,218,113,255,68,68,35,255,
+    0,0,0,65,0,0,0,0,0,0,0,66,68,68,36,255,218,218,114,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,218,218,113,255,
+    68,68,35,255,0,0,0,65,0,0,0,0,0,0,0,66,68,68,36,255,218,218,114,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    218,218,113,255,68,68,35,255,0,0,0,65,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1,1,0,53,64,64,33,254,211,211,109,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,210,210,109,255,64,64,33,254,1,1,0,51,
+    0,0,0,0,1,1,0,53,64,64,33,254,211,211,109,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    230,230,120,255,206,206,107,255,120,120,62,255,33,33,17,255,2,2,1,255,2,2,1,255,34,34,18,255,121,121,63,255,
+    207,207,107,255,230,230,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,210,210,109,255,64,64,33,254,
+    1,1,0,51,0,0,0,0,1,1,0,53,64,64,33,254,211,211,109,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,210,210,109,255,
+    64,64,33,254,1,1,0,51,0,0,0,0,1,1,0,53,64,64,33,254,211,211,109,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    210,210,109,255,64,64,33,254,1,1,0,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    5,5,2,41,59,59,31,245,196,196,102,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,224,224,117,255,
+    220,220,114,255,229,229,119,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,229,229,119,255,219,219,114,255,
+    224,224,117,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,195,195,101,255,59,59,31,243,5,5,3,41,
+    0,0,0,0,5,5,2,41,59,59,31,245,196,196,102,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    217,217,113,255,104,104,54,255,12,12,6,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,12,12,6,255,
+    105,105,54,255,217,217,112,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,195,195,101,255,59,59,31,243,
+    5,5,3,41,0,0,0,0,5,5,2,41,59,59,31,245,196,196,102,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,195,195,101,255,
+    59,59,31,243,5,5,3,41,0,0,0,0,5,5,2,41,59,59,31,245,196,196,102,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,224,224,117,255,220,220,114,255,229,229,119,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,229,229,119,255,219,219,114,255,224,224,117,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    195,195,101,255,59,59,31,243,5,5,3,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    8,8,4,33,51,51,26,217,174,174,91,255,231,231,120,255,231,231,120,255,231,231,120,255,222,222,115,255,136,136,71,255,
+    115,115,60,255,216,216,112,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,215,215,112,255,114,114,60,255,
+    136,136,71,255,222,222,115,255,231,231,120,255,231,231,120,255,231,231,120,255,173,173,90,255,50,50,26,215,8,8,4,32,
+    0,0,0,0,8,8,4,33,51,51,26,217,174,174,91,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    161,161,84,255,16,16,8,255,0,0,0,255,9,9,5,255,77,77,40,255,77,77,40,255,9,9,4,255,0,0,0,255,
+    16,16,8,255,161,161,84,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,173,173,90,255,50,50,26,215,
+    8,8,4,32,0,0,0,0,8,8,4,33,51,51,26,217,174,174,91,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,173,173,90,255,
+    50,50,26,215,8,8,4,32,0,0,0,0,8,8,4,33,51,51,26,217,174,174,91,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,222,222,115,255,136,136,71,255,115,115,60,255,216,216,112,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,215,215,112,255,114,114,60,255,136,136,71,255,222,222,115,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    173,173,90,255,50,50,26,215,8,8,4,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    2,2,1,21,26,26,14,168,142,142,74,251,231,231,120,255,231,231,120,255,231,231,120,255,229,229,119,255,128,128,66,255,
+    35,35,18,255,196,196,102,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,196,196,102,255,34,34,18,255,
+    128,128,67,255,229,229,119,255,231,231,120,255,231,231,120,255,231,231,120,255,141,141,74,251,25,25,13,166,2,2,1,21,
+    0,0,0,0,2,2,1,21,26,26,14,168,142,142,74,251,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    74,74,38,255,0,0,0,255,2,2,1,255,108,108,56,255,206,206,107,255,206,206,107,255,108,108,56,255,2,2,1,255,
+    0,0,0,255,75,75,39,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,141,141,74,251,25,25,13,166,
+    2,2,1,21,0,0,0,0,2,2,1,21,26,26,14,168,142,142,74,251,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,227,227,118,255,227,227,118,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,141,141,74,251,
+    25,25,13,166,2,2,1,21,0,0,0,0,2,2,1,21,26,26,14,168,142,142,74,251,231,231,120,255,231,231,120,255,
+    231,231,120,255,229,229,119,255,128,128,66,255,35,35,18,255,196,196,102,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,196,196,102,255,34,34,18,255,128,128,67,255,229,229,119,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    141,141,74,251,25,25,13,166,2,2,1,21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,7,2,2,1,112,103,103,53,252,221,221,115,255,231,231,120,255,231,231,120,255,231,231,120,255,185,185,96,255,
+    49,49,26,255,102,102,53,255,229,229,119,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,229,229,119,255,100,100,52,255,50,50,26,255,
+    187,187,97,255,231,231,120,255,231,231,120,255,231,231,120,255,220,220,114,255,101,101,53,252,2,2,1,110,0,0,0,7,
+    0,0,0,0,0,0,0,7,2,2,1,112,103,103,53,252,221,221,115,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,227,227,118,255,
+    10,10,6,255,0,0,0,255,44,44,22,255,183,183,95,255,231,231,120,255,231,231,120,255,182,182,95,255,43,43,22,255,
+    0,0,0,255,11,11,6,255,228,228,119,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,220,220,114,255,101,101,53,252,2,2,1,110,
+    0,0,0,7,0,0,0,0,0,0,0,7,2,2,1,112,103,103,53,252,221,221,115,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,226,226,118,255,
+    208,208,108,255,166,166,86,255,100,100,52,255,48,48,25,255,13,13,6,255,2,2,1,255,2,2,1,255,13,13,7,255,
+    49,49,25,255,101,101,52,255,167,167,87,255,209,209,108,255,226,226,118,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,220,220,114,255,101,101,53,252,
+    2,2,1,110,0,0,0,7,0,0,0,0,0,0,0,7,2,2,1,112,103,103,53,252,221,221,115,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,185,185,96,255,49,49,26,255,102,102,53,255,229,229,119,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    229,229,119,255,100,100,52,255,50,50,26,255,187,187,97,255,231,231,120,255,231,231,120,255,231,231,120,255,220,220,114,255,
+    101,101,53,252,2,2,1,110,0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,6,6,3,66,61,61,32,224,189,189,98,254,231,231,120,255,231,231,120,255,231,231,120,255,228,228,118,255,
+    117,117,61,255,23,23,12,255,184,184,96,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,183,183,95,255,23,23,12,255,119,119,62,255,
+    228,228,118,255,231,231,120,255,231,231,120,255,231,231,120,255,188,188,98,254,60,60,31,224,6,6,3,65,0,0,0,0,
+    0,0,0,0,0,0,0,0,6,6,3,66,61,61,32,224,189,189,98,254,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,213,213,111,255,
+    0,0,0,255,0,0,0,255,68,68,35,255,200,200,104,255,231,231,120,255,231,231,120,255,199,199,103,255,68,68,35,255,
+    0,0,0,255,0,0,0,255,214,214,111,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,188,188,98,254,60,60,31,224,6,6,3,65,
+    0,0,0,0,0,0,0,0,0,0,0,0,6,6,3,66,61,61,32,224,189,189,98,254,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,230,230,119,255,206,206,107,255,146,146,76,255,
+    64,64,33,255,8,8,4,255,31,31,16,255,54,54,28,255,71,71,37,255,80,80,41,255,80,80,41,255,71,71,37,255,
+    54,54,28,255,31,31,16,255,8,8,4,255,65,65,33,255,146,146,76,255,206,206,107,255,230,230,119,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,188,188,98,254,60,60,31,224,
+    6,6,3,65,0,0,0,0,0,0,0,0,0,0,0,0,6,6,3,66,61,61,32,224,189,189,98,254,231,231,120,255,
+    231,231,120,255,231,231,120,255,228,228,118,255,117,117,61,255,23,23,12,255,184,184,96,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    183,183,95,255,23,23,12,255,119,119,62,255,228,228,118,255,231,231,120,255,231,231,120,255,231,231,120,255,188,188,98,254,
+    60,60,31,224,6,6,3,65,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,26,16,16,9,164,142,142,74,253,226,226,117,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    201,201,105,255,63,63,33,255,65,65,34,255,197,197,102,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,195,195,101,255,63,63,33,255,64,64,33,255,202,202,105,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,226,226,117,255,141,141,73,253,16,16,8,164,0,0,0,26,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,26,16,16,9,164,142,142,74,253,226,226,117,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,215,215,112,255,
+    0,0,0,255,0,0,0,255,66,66,34,255,198,198,103,255,231,231,120,255,231,231,120,255,198,198,103,255,66,66,34,255,
+    0,0,0,255,0,0,0,255,216,216,112,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,226,226,117,255,141,141,73,253,16,16,8,164,0,0,0,26,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,16,16,9,164,142,142,74,253,226,226,117,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,228,228,118,255,182,182,95,255,85,85,44,255,18,18,9,255,
+    43,43,22,255,113,113,59,255,162,162,84,255,197,197,102,255,222,222,115,255,231,231,120,255,231,231,120,255,222,222,115,255,
+    197,197,102,255,162,162,84,255,113,113,59,255,43,43,22,255,18,18,9,255,86,86,45,255,182,182,95,255,228,228,118,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,226,226,117,255,141,141,73,253,16,16,8,164,
+    0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,16,16,9,164,142,142,74,253,226,226,117,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,201,201,105,255,63,63,33,255,65,65,34,255,197,197,102,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,195,195,101,255,
+    63,63,33,255,64,64,33,255,202,202,105,255,231,231,120,255,231,231,120,255,231,231,120,255,226,226,117,255,141,141,73,253,
+    16,16,8,164,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,3,3,3,2,99,68,68,35,230,208,208,108,254,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,182,182,94,255,30,30,15,255,82,82,42,255,195,195,101,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,194,194,101,255,80,80,41,255,31,31,16,255,183,183,95,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,207,207,108,254,65,65,34,229,3,3,1,98,0,0,0,3,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,3,3,3,2,99,68,68,35,230,208,208,108,254,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,228,228,118,255,
+    19,19,10,255,0,0,0,255,34,34,18,255,176,176,92,255,231,231,120,255,231,231,120,255,176,176,92,255,34,34,18,255,
+    0,0,0,255,20,20,11,255,229,229,119,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,207,207,108,254,65,65,34,229,3,3,1,98,0,0,0,3,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,3,3,2,99,68,68,35,230,208,208,108,254,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,175,175,91,255,51,51,27,255,21,21,11,255,98,98,51,255,
+    178,178,93,255,224,224,117,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,224,224,117,255,178,178,93,255,98,98,51,255,21,21,11,255,52,52,27,255,175,175,91,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,207,207,108,254,65,65,34,229,3,3,1,98,
+    0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,3,3,2,99,68,68,35,230,208,208,108,254,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,182,182,94,255,30,30,15,255,82,82,42,255,195,195,101,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,194,194,101,255,80,80,41,255,
+    31,31,16,255,183,183,95,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,207,207,108,254,65,65,34,229,
+    3,3,1,98,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,3,3,2,25,11,11,6,181,138,138,72,254,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,229,229,119,255,159,159,83,255,33,33,17,255,66,66,34,255,183,183,95,255,229,229,119,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,229,229,119,255,182,182,94,255,65,65,34,255,33,33,17,255,160,160,83,255,230,230,119,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,135,135,70,254,11,11,5,180,2,2,1,24,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,3,3,2,25,11,11,6,181,138,138,72,254,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    78,78,41,255,0,0,0,255,4,4,2,255,96,96,50,255,216,216,112,255,216,216,112,255,95,95,50,255,4,4,2,255,
+    0,0,0,255,79,79,42,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,135,135,70,254,11,11,5,180,2,2,1,24,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,3,2,25,11,11,6,181,138,138,72,254,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,217,217,113,255,35,35,19,255,24,24,12,255,131,131,67,255,215,215,111,255,
+    230,230,119,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,230,230,119,255,215,215,111,255,130,130,67,255,23,23,12,255,36,36,19,255,
+    218,218,113,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,135,135,70,254,11,11,5,180,2,2,1,24,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,3,2,25,11,11,6,181,138,138,72,254,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,229,229,119,255,159,159,83,255,33,33,17,255,66,66,34,255,
+    183,183,95,255,229,229,119,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,229,229,119,255,182,182,94,255,65,65,34,255,33,33,17,255,
+    160,160,83,255,230,230,119,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,135,135,70,254,11,11,5,180,
+    2,2,1,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,2,2,0,66,13,13,7,217,192,192,100,254,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,229,229,119,255,180,180,94,255,61,61,32,255,24,24,12,255,105,105,54,255,195,195,101,255,
+    214,214,111,255,225,225,117,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,225,225,117,255,214,214,111,255,
+    194,194,101,255,103,103,53,255,23,23,12,255,62,62,32,255,181,181,94,255,229,229,119,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,190,190,99,254,12,12,6,216,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,0,66,13,13,7,217,192,192,100,254,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    179,179,93,255,20,20,11,255,0,0,0,255,0,0,0,255,33,33,17,255,32,32,17,255,0,0,0,255,0,0,0,255,
+    21,21,11,255,180,180,93,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,190,190,99,254,12,12,6,216,0,0,0,64,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,0,66,13,13,7,217,192,192,100,254,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,154,154,80,255,150,150,78,255,230,230,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,230,230,120,255,149,149,77,255,154,154,80,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,190,190,99,254,12,12,6,216,0,0,0,64,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,0,66,13,13,7,217,
+    192,192,100,254,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,229,229,119,255,180,180,94,255,61,61,32,255,
+    24,24,12,255,105,105,54,255,195,195,101,255,214,214,111,255,225,225,117,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,225,225,117,255,214,214,111,255,194,194,101,255,103,103,53,255,23,23,12,255,62,62,32,255,181,181,94,255,
+    229,229,119,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,190,190,99,254,12,12,6,216,0,0,0,64,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,6,6,4,119,64,64,34,247,200,200,104,254,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,204,204,106,255,116,116,60,255,51,51,26,255,34,34,17,255,
+    87,87,45,255,132,132,69,255,158,158,82,255,167,167,87,255,167,167,87,255,158,158,82,255,132,132,68,255,86,86,44,255,
+    34,34,17,255,51,51,27,255,117,117,60,255,204,204,106,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,199,199,103,254,62,62,33,247,8,8,4,117,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,6,6,4,119,64,64,34,247,200,200,104,254,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    220,220,115,255,126,126,66,255,22,22,11,255,1,1,0,255,0,0,0,255,0,0,0,255,1,1,0,255,22,22,12,255,
+    127,127,66,255,221,221,115,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,199,199,103,254,62,62,33,247,8,8,4,117,0,0,0,1,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,6,6,4,119,64,64,34,247,
+    200,200,104,254,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,199,199,103,254,62,62,33,247,8,8,4,117,0,0,0,1,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,6,6,4,119,
+    64,64,34,247,200,200,104,254,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,204,204,106,255,
+    116,116,60,255,51,51,26,255,34,34,17,255,87,87,45,255,132,132,69,255,158,158,82,255,167,167,87,255,167,167,87,255,
+    158,158,82,255,132,132,68,255,86,86,44,255,34,34,17,255,51,51,27,255,117,117,60,255,204,204,106,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,199,199,103,254,62,62,33,247,8,8,4,117,0,0,0,1,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,16,16,9,161,91,91,47,251,201,201,104,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,227,227,118,255,188,188,98,255,124,124,64,255,
+    84,84,44,255,53,53,28,255,40,40,21,255,40,40,20,255,40,40,20,255,40,40,21,255,53,53,27,255,84,84,44,255,
+    125,125,65,255,189,189,98,255,227,227,118,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    200,200,104,255,89,89,46,251,15,15,8,161,0,0,0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,16,16,9,161,91,91,47,251,
+    201,201,104,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,214,214,111,255,140,140,73,255,68,68,35,255,33,33,17,255,33,33,17,255,68,68,35,255,141,141,73,255,
+    214,214,111,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,200,200,104,255,89,89,46,251,15,15,8,161,0,0,0,10,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,16,16,9,161,
+    91,91,47,251,201,201,104,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,200,200,104,255,89,89,46,251,15,15,8,161,0,0,0,10,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,
+    16,16,9,161,91,91,47,251,201,201,104,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    227,227,118,255,188,188,98,255,124,124,64,255,84,84,44,255,53,53,28,255,40,40,21,255,40,40,20,255,40,40,20,255,
+    40,40,21,255,53,53,27,255,84,84,44,255,125,125,65,255,189,189,98,255,227,227,118,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,200,200,104,255,89,89,46,251,15,15,8,161,0,0,0,10,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,1,35,21,21,11,166,90,90,47,251,
+    199,199,104,254,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,228,228,119,255,
+    210,210,109,255,189,189,98,255,175,175,91,255,167,167,87,255,167,167,87,255,175,175,91,255,189,189,98,255,210,210,109,255,
+    228,228,118,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,199,199,104,254,
+    89,89,47,251,21,21,11,166,2,2,1,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,1,35,21,21,11,166,
+    90,90,47,251,199,199,104,254,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,225,225,117,255,199,199,103,255,176,176,92,255,176,176,92,255,199,199,103,255,225,225,117,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    199,199,104,254,89,89,47,251,21,21,11,166,2,2,1,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,1,35,
+    21,21,11,166,90,90,47,251,199,199,104,254,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,199,199,104,254,89,89,47,251,21,21,11,166,2,2,1,34,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    2,2,1,35,21,21,11,166,90,90,47,251,199,199,104,254,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,228,228,119,255,210,210,109,255,189,189,98,255,175,175,91,255,167,167,87,255,167,167,87,255,
+    175,175,91,255,189,189,98,255,210,210,109,255,228,228,118,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,199,199,104,254,89,89,47,251,21,21,11,166,2,2,1,34,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,2,1,35,16,16,8,162,
+    64,64,34,247,192,192,100,254,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,191,191,99,254,62,62,33,247,
+    15,15,8,161,2,2,1,34,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,2,1,35,
+    16,16,8,162,64,64,34,247,192,192,100,254,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,191,191,99,254,
+    62,62,33,247,15,15,8,161,2,2,1,34,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,
+    2,2,1,35,16,16,8,162,64,64,34,247,192,192,100,254,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    191,191,99,254,62,62,33,247,15,15,8,161,2,2,1,34,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,2,2,2,1,35,16,16,8,162,64,64,34,247,192,192,100,254,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,191,191,99,254,62,62,33,247,15,15,8,161,2,2,1,34,0,0,0,2,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,
+    7,7,4,118,12,12,7,216,137,137,71,254,207,207,108,254,226,226,117,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,226,226,117,255,207,207,108,254,136,136,71,254,12,12,7,216,8,8,4,117,
+    0,0,0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,11,7,7,4,118,12,12,7,216,137,137,71,254,207,207,108,254,226,226,117,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,226,226,117,255,207,207,108,254,136,136,71,254,12,12,7,216,
+    8,8,4,117,0,0,0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,11,7,7,4,118,12,12,7,216,137,137,71,254,207,207,108,254,226,226,117,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,226,226,117,255,207,207,108,254,136,136,71,254,
+    12,12,7,216,8,8,4,117,0,0,0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,11,7,7,4,118,12,12,7,216,137,137,71,254,207,207,108,254,226,226,117,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,226,226,117,255,207,207,108,254,
+    136,136,71,254,12,12,7,216,8,8,4,117,0,0,0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,1,0,0,0,64,11,11,6,181,66,66,35,230,141,141,73,253,189,189,98,254,220,220,114,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,220,220,114,255,188,188,98,254,141,141,73,253,65,65,34,229,10,10,5,180,0,0,0,64,0,0,0,1,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,1,0,0,0,64,11,11,6,181,66,66,35,230,141,141,73,253,189,189,98,254,220,220,114,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,220,220,114,255,188,188,98,254,141,141,73,253,65,65,34,229,10,10,5,180,0,0,0,64,
+    0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,64,11,11,6,181,66,66,35,230,141,141,73,253,189,189,98,254,
+    220,220,114,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,220,220,114,255,188,188,98,254,141,141,73,253,65,65,34,229,10,10,5,180,
+    0,0,0,64,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,64,11,11,6,181,66,66,35,230,141,141,73,253,
+    189,189,98,254,220,220,114,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,
+    231,231,120,255,231,231,120,255,231,231,120,255,231,231,120,255,220,220,114,255,188,188,98,254,141,141,73,253,65,65,34,229,
+    10,10,5,180,0,0,0,64,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,2,2,1,25,3,3,1,98,16,16,8,163,61,61,31,224,101,101,53,252,141,141,74,251,
+    173,173,90,255,195,195,101,255,210,210,109,255,218,218,113,255,218,218,113,255,210,210,109,255,195,195,101,255,173,173,90,255,
+    141,141,74,251,101,101,53,252,60,60,31,224,16,16,8,164,3,3,1,97,2,2,1,24,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,2,2,1,25,3,3,1,98,16,16,8,163,61,61,31,224,101,101,53,252,
+    141,141,74,251,173,173,90,255,195,195,101,255,210,210,109,255,218,218,113,255,218,218,113,255,210,210,109,255,195,195,101,255,
+    173,173,90,255,141,141,74,251,101,101,53,252,60,60,31,224,16,16,8,164,3,3,1,97,2,2,1,24,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,1,25,3,3,1,98,16,16,8,163,61,61,31,224,
+    101,101,53,252,141,141,74,251,173,173,90,255,195,195,101,255,210,210,109,255,218,218,113,255,218,218,113,255,210,210,109,255,
+    195,195,101,255,173,173,90,255,141,141,74,251,101,101,53,252,60,60,31,224,16,16,8,164,3,3,1,97,2,2,1,24,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,1,25,3,3,1,98,16,16,8,163,
+    61,61,31,224,101,101,53,252,141,141,74,251,173,173,90,255,195,195,101,255,210,210,109,255,218,218,113,255,218,218,113,255,
+    210,210,109,255,195,195,101,255,173,173,90,255,141,141,74,251,101,101,53,252,60,60,31,224,16,16,8,164,3,3,1,97,
+    2,2,1,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,26,6,6,3,66,2,2,1,111,25,25,13,166,
+    51,51,27,215,59,59,31,244,64,64,33,254,68,68,35,255,68,68,35,255,64,64,33,254,59,59,30,244,50,50,26,215,
+    25,25,13,166,2,2,1,110,6,6,3,65,0,0,0,26,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,26,6,6,3,66,2,2,1,111,
+    25,25,13,166,51,51,27,215,59,59,31,244,64,64,33,254,68,68,35,255,68,68,35,255,64,64,33,254,59,59,30,244,
+    50,50,26,215,25,25,13,166,2,2,1,110,6,6,3,65,0,0,0,26,0,0,0,3,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,26,6,6,3,66,
+    2,2,1,111,25,25,13,166,51,51,27,215,59,59,31,244,64,64,33,254,68,68,35,255,68,68,35,255,64,64,33,254,
+    59,59,30,244,50,50,26,215,25,25,13,166,2,2,1,110,6,6,3,65,0,0,0,26,0,0,0,3,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,26,
+    6,6,3,66,2,2,1,111,25,25,13,166,51,51,27,215,59,59,31,244,64,64,33,254,68,68,35,255,68,68,35,255,
+    64,64,33,254,59,59,30,244,50,50,26,215,25,25,13,166,2,2,1,110,6,6,3,65,0,0,0,26,0,0,0,3,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,2,2,1,21,
+    8,8,4,33,5,5,3,40,1,1,0,52,0,0,0,66,0,0,0,66,1,1,0,52,5,5,3,40,8,8,4,32,
+    2,2,1,21,0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,
+    2,2,1,21,8,8,4,33,5,5,3,40,1,1,0,52,0,0,0,66,0,0,0,66,1,1,0,52,5,5,3,40,
+    8,8,4,32,2,2,1,21,0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,7,2,2,1,21,8,8,4,33,5,5,3,40,1,1,0,52,0,0,0,66,0,0,0,66,1,1,0,52,
+    5,5,3,40,8,8,4,32,2,2,1,21,0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,7,2,2,1,21,8,8,4,33,5,5,3,40,1,1,0,52,0,0,0,66,0,0,0,66,
+    1,1,0,52,5,5,3,40,8,8,4,32,2,2,1,21,0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,
+    255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,
+    255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,
+    255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
@@ -0,0 +1,26 @@
+// Generated by tools/pack_assets.py from Graphics/; do not edit.
+#pragma once
+
+// Every sprite the game draws, packed into one RGBA atlas that is compiled
+// into the binary, so startup needs no file reads or image decoding.
+enum Sprite {
+    SPRITE_BOMB,
+    SPRITE_BOMB_EXPLODED,
+    SPRITE_FLAG,
+    SPRITE_QUESTION,
+    SPRITE_FACE,        // SPRITE_FACE + 0..3: playing, worried, lost, won
+    SPRITE_ICON = SPRITE_FACE + 4,
+    SPRITE_DIGIT,       // SPRITE_DIGIT + n - 1 for the number n, drawn white
+    SPRITE_COUNT = SPRITE_DIGIT + 8
+};
+
+struct SpriteRect {
+    short x, y, width, height;
+};
+
+const int ATLAS_WIDTH = 256;
+const int ATLAS_HEIGHT = 127;
+
+extern const SpriteRect SPRITES[SPRITE_COUNT];
+// ATLAS_WIDTH * ATLAS_HEIGHT pixels, 8-bit RGBA, top row first.
+extern const unsigned char ATLAS_PIXELS[];
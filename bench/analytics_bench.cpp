@@ -0,0 +1,52 @@
+// Board metrics per second: 3BV, openings and isolated numbers alone and
+// with opening sizes, against generating the same board.
+#include <benchmark/benchmark.h>
+#include "../analytics.h"
+#include "../game.h"
+
+namespace {
+
+// Args: side, mine percentage.
+Game MakeGame(benchmark::State& state) {
+    int n = (int)state.range(0);
+    Game game(n, n, (int)((long long)n * n * state.range(1) / 100), 7);
+    game.PlaceMines(n / 2, n / 2);
+    return game;
+}
+
+void BM_Analyze(benchmark::State& state) {
+    Game game = MakeGame(state);
+    BoardAnalyzer analyzer;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(analyzer.Analyze(game.grid));
+    }
+    state.SetBytesProcessed(state.iterations() * (int64_t)game.grid.PaddedSize());
+}
+
+void BM_AnalyzeSizes(benchmark::State& state) {
+    Game game = MakeGame(state);
+    BoardAnalyzer analyzer;
+    std::vector<int> sizes;
+    for (auto _ : state) {
+        sizes.clear();
+        benchmark::DoNotOptimize(analyzer.Analyze(game.grid, &sizes));
+    }
+    state.SetBytesProcessed(state.iterations() * (int64_t)game.grid.PaddedSize());
+}
+
+// Placing mines and counting numbers, for scale.
+void BM_GenerateForAnalysis(benchmark::State& state) {
+    Game game = MakeGame(state);
+    uint64_t seed = 1;
+    for (auto _ : state) {
+        game.NewGame(seed++);
+        game.PlaceMines(game.rows / 2, game.cols / 2);
+    }
+    state.SetBytesProcessed(state.iterations() * (int64_t)game.grid.PaddedSize());
+}
+
+}
+
+BENCHMARK(BM_Analyze)->Args({ 16, 16 })->Args({ 1000, 10 })->Args({ 1000, 20 })->Args({ 4000, 20 })->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_AnalyzeSizes)->Args({ 16, 16 })->Args({ 1000, 10 })->Args({ 1000, 20 })->Args({ 4000, 20 })->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_GenerateForAnalysis)->Args({ 16, 16 })->Args({ 1000, 20 })->Unit(benchmark::kMicrosecond);
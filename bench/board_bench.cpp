@@ -0,0 +1,31 @@
+// Games per second on the preset sizes: the compile-time Board against the
+// dynamic Game, both played by SimpleBot through the Minefield interface.
+#include <benchmark/benchmark.h>
+#include "../board.h"
+#include "../bot.h"
+
+namespace {
+
+// Args: rows, cols, mines, fixed.
+void BM_PresetGames(benchmark::State& state) {
+    int rows = (int)state.range(0), cols = (int)state.range(1), mines = (int)state.range(2);
+    std::unique_ptr<Minefield> board = MakeBoard(rows, cols, mines, 0, state.range(3) != 0);
+    SimpleBot bot(1);
+    uint64_t seed = 1;
+    long long wins = 0;
+    for (auto _ : state) {
+        board->NewGame(SplitMix64(seed));
+        bot.NewGame(*board);
+        while (!board->GameOver() && !board->Victory()) {
+            Move m = bot.NextMove(*board);
+            board->HandleClick(m.row, m.col, m.leftClick);
+        }
+        wins += board->Victory();
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["win_rate"] = state.iterations() ? (double)wins / state.iterations() : 0.0;
+}
+
+}
+
+BENCHMARK(BM_PresetGames)->Args({ 9, 9, 10, 0 })->Args({ 9, 9, 10, 1 })->Args({ 16, 16, 40, 0 })->Args({ 16, 16, 40, 1 });
@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+"""Compares two Google Benchmark JSON files, e.g. the committed baseline and
+a fresh `--benchmark_out` run:
+
+    bench/compare.py bench/baseline.json build/bench_results.json
+
+Prints the change in real time per benchmark present in both and exits
+with status 1 if any got slower by more than --threshold percent.
+"""
+import argparse
+import json
+import sys
+
+TO_NS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load(path):
+    with open(path) as f:
+        data = json.load(f)
+    times = {}
+    for b in data["benchmarks"]:
+        if b.get("run_type", "iteration") != "iteration" or "error_occurred" in b:
+            continue
+        times[b["name"]] = b["real_time"] * TO_NS[b.get("time_unit", "ns")]
+    return times
+
+
+def fmt(ns):
+    for unit, scale in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if ns >= scale:
+            return "%.2f %s" % (ns / scale, unit)
+    return "%.1f ns" % ns
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--threshold", type=float, default=15.0)
+    args = parser.parse_args()
+
+    base, cur = load(args.baseline), load(args.current)
+    names = [n for n in cur if n in base]
+    if not names:
+        print("no benchmarks in common")
+        return 1
+
+    width = max(len(n) for n in names)
+    regressions = 0
+    for name in names:
+        change = 100.0 * (cur[name] - base[name]) / base[name]
+        flag = ""
+        if change > args.threshold:
+            flag = "  SLOWER"
+            regressions += 1
+        elif change < -args.threshold:
+            flag = "  faster"
+        print("%-*s %12s %12s %+8.1f%%%s" % (width, name, fmt(base[name]), fmt(cur[name]), change, flag))
+
+    missing = sorted(set(base) - set(cur))
+    if missing:
+        print("%d baseline benchmarks not in this run" % len(missing))
+    print("%d of %d benchmarks more than %.0f%% slower" % (regressions, len(names), args.threshold))
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
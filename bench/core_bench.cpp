@@ -0,0 +1,137 @@
+// The Game entry points across board sizes and mine densities: arguments are
+// the side of a square board and the percentage of cells that are mines.
+// Items are cells for whole-board work and clicks otherwise.
+#include <benchmark/benchmark.h>
+#include "../game.h"
+#include <cstring>
+#include <vector>
+
+namespace {
+
+const uint64_t SEED = 12345;
+
+int Mines(int n, int percent) {
+    return n * n * percent / 100;
+}
+
+// A board with its mines placed and nothing revealed.
+void Placed(Game& game, int n, int percent) {
+    game.Init(n, n, Mines(n, percent), SEED);
+    game.PlaceMines(n / 2, n / 2);
+    game.firstClick = false;
+}
+
+void BM_PlaceMines(benchmark::State& state) {
+    int n = (int)state.range(0);
+    Game game(n, n, Mines(n, (int)state.range(1)), SEED);
+    for (auto _ : state) {
+        game.PlaceMines(n / 2, n / 2);
+    }
+    state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+void BM_CalculateNumbers(benchmark::State& state) {
+    int n = (int)state.range(0);
+    Game game;
+    Placed(game, n, (int)state.range(1));
+    for (auto _ : state) {
+        game.CalculateNumbers();
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+// Reveals one numbered cell and hides it again; no flood.
+void BM_Reveal(benchmark::State& state) {
+    int n = (int)state.range(0);
+    Game game;
+    Placed(game, n, (int)state.range(1));
+    std::vector<int> numbered;
+    for (int r = 0; r < n; r++)
+        for (int c = 0; c < n; c++) {
+            int idx = game.grid.Index(r, c);
+            if (!game.grid.IsMine(idx) && game.grid.Adjacent(idx) > 0) numbered.push_back(idx);
+        }
+    if (numbered.empty()) {
+        state.SkipWithError("no numbered cells");
+        return;
+    }
+    size_t i = 0;
+    for (auto _ : state) {
+        int idx = numbered[i];
+        game.Reveal(game.grid.RowOf(idx), game.grid.ColOf(idx));
+        game.grid.SetState(idx, CellState::Hidden);
+        game.revealLog.pop_back();
+        game.revealedCnt--;
+        i = (i + 1) % numbered.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Opens the region around the first click; the board is restored untimed.
+void BM_FloodReveal(benchmark::State& state) {
+    int n = (int)state.range(0);
+    Game game;
+    Placed(game, n, (int)state.range(1));
+    std::vector<uint8_t> initial(game.grid.Data(), game.grid.Data() + game.grid.PaddedSize());
+    long long opened = 0;
+    for (auto _ : state) {
+        game.Reveal(n / 2, n / 2);
+        opened += game.revealedCnt;
+        state.PauseTiming();
+        memcpy(game.grid.Data(), initial.data(), initial.size());
+        game.revealLog.clear();
+        game.revealedCnt = 0;
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(opened);
+}
+
+// Half of the safe cells revealed and half of the mines flagged.
+void BM_CheckVictory(benchmark::State& state) {
+    int n = (int)state.range(0);
+    Game game;
+    Placed(game, n, (int)state.range(1));
+    int turn = 0;
+    for (int r = 0; r < n; r++)
+        for (int c = 0; c < n; c++) {
+            if (++turn % 2) continue;
+            game.HandleClick(r, c, !game.grid.IsMine(r, c));
+        }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(game.CheckVictory());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Random clicks that never lose: reveals on safe cells, marks on mines.
+// A won board is started over untimed.
+void BM_HandleClick(benchmark::State& state) {
+    int n = (int)state.range(0);
+    Game game;
+    Placed(game, n, (int)state.range(1));
+    Xoshiro256 rng(7);
+    for (auto _ : state) {
+        int r = (int)rng.Below((uint64_t)n), c = (int)rng.Below((uint64_t)n);
+        game.HandleClick(r, c, !game.grid.IsMine(r, c));
+        if (game.victory) {
+            state.PauseTiming();
+            Placed(game, n, (int)state.range(1));
+            state.ResumeTiming();
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void Sizes(benchmark::internal::Benchmark* b) {
+    b->ArgNames({ "n", "density" })->ArgsProduct({ { 16, 100, 1000 }, { 10, 20, 30 } });
+}
+
+}
+
+BENCHMARK(BM_PlaceMines)->Apply(Sizes)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_CalculateNumbers)->Apply(Sizes)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Reveal)->Apply(Sizes);
+BENCHMARK(BM_FloodReveal)->Apply(Sizes)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_CheckVictory)->Apply(Sizes);
+BENCHMARK(BM_HandleClick)->Apply(Sizes);
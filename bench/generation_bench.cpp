@@ -0,0 +1,101 @@
+// Board generation throughput (boards/sec): rejection sampling with branchy
+// per-neighbor counting against bitboard placement and vectorised adjacency,
+// and how striped generation of huge boards scales with threads.
+#include <benchmark/benchmark.h>
+#include "../game.h"
+#include <algorithm>
+#include <cstdlib>
+#include <thread>
+
+namespace {
+
+void LegacyGenerate(Grid& grid, int mines, int row, int col) {
+    int rows = grid.Rows(), cols = grid.Cols();
+    int placed = 0;
+    while (placed < mines) {
+        int r = rand() % rows;
+        int c = rand() % cols;
+        if (abs(r - row) <= 1 && abs(c - col) <= 1) continue;
+        int idx = grid.Index(r, c);
+        if (!grid.IsMine(idx)) {
+            grid.SetMine(idx, true);
+            placed++;
+        }
+    }
+    int dx[8] = { -1, -1, -1, 0, 0, 1, 1, 1 };
+    int dy[8] = { -1, 0, 1, -1, 1, -1, 0, 1 };
+    for (int i = 0; i < rows; i++) {
+        for (int j = 0; j < cols; j++) {
+            if (!grid.IsMine(i, j)) {
+                int cnt = 0;
+                for (int d = 0; d < 8; d++) {
+                    int nx = i + dx[d];
+                    int ny = j + dy[d];
+                    if (nx >= 0 && nx < rows && ny >= 0 && ny < cols) {
+                        if (grid.IsMine(nx, ny)) cnt++;
+                    }
+                }
+                grid.SetAdjacent(grid.Index(i, j), cnt);
+            }
+        }
+    }
+}
+
+int MinesFor(int n, int densityPct) {
+    int mines = (int)((long long)n * n * densityPct / 100);
+    return mines < n * n - 9 ? mines : n * n - 9;
+}
+
+void BM_LegacyGenerate(benchmark::State& state) {
+    int n = (int)state.range(0);
+    int mines = MinesFor(n, (int)state.range(1));
+    Grid grid(n, n);
+    srand(1);
+    for (auto _ : state) {
+        grid.Clear();
+        LegacyGenerate(grid, mines, n / 2, n / 2);
+        benchmark::ClobberMemory();
+    }
+    state.counters["boards/s"] = benchmark::Counter((double)state.iterations(), benchmark::Counter::kIsRate);
+}
+
+void BM_Generate(benchmark::State& state) {
+    int n = (int)state.range(0);
+    Game game(n, n, MinesFor(n, (int)state.range(1)), 1);
+    for (auto _ : state) {
+        game.NewGame();
+        game.PlaceMines(n / 2, n / 2);
+        benchmark::ClobberMemory();
+    }
+    state.counters["boards/s"] = benchmark::Counter((double)state.iterations(), benchmark::Counter::kIsRate);
+}
+
+// Clearing, mining and counting a huge board at 15% mines, as the first
+// click does; wall-clock time, since the work happens on other threads.
+void BM_GenerateThreads(benchmark::State& state) {
+    int n = (int)state.range(0);
+    Game game(n, n, MinesFor(n, 15), 1);
+    game.threads = (int)state.range(1);
+    for (auto _ : state) {
+        game.NewGame();
+        game.PlaceMines(n / 2, n / 2);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * (int64_t)n * n);
+}
+
+// 1, 2, 4, ... threads up to the number of cores.
+void ThreadCounts(benchmark::internal::Benchmark* b) {
+    int cores = (int)std::max(1u, std::thread::hardware_concurrency());
+    b->ArgNames({ "n", "threads" });
+    for (int n : { 8000, 20000 }) {
+        for (int t = 1; t < cores; t *= 2) b->Args({ n, t });
+        b->Args({ n, cores });
+    }
+}
+
+}
+
+BENCHMARK(BM_LegacyGenerate)->ArgsProduct({ { 16, 100, 1000 }, { 15, 50, 90 } })->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Generate)->ArgsProduct({ { 16, 100, 1000 }, { 15, 50, 90 } })->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_GenerateThreads)->Apply(ThreadCounts)->UseRealTime()->Unit(benchmark::kMillisecond);
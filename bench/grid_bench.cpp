@@ -0,0 +1,126 @@
+// Compares the legacy vector<vector<Cell>> board layout with the flat Grid.
+#include <benchmark/benchmark.h>
+#include "../grid.h"
+#include <random>
+#include <vector>
+
+namespace {
+
+struct LegacyCell {
+    bool isMine = false;
+    int adjacent = 0;
+    CellState state = CellState::Hidden;
+};
+
+using LegacyGrid = std::vector<std::vector<LegacyCell>>;
+
+LegacyGrid MakeLegacy(int n) {
+    LegacyGrid g(n, std::vector<LegacyCell>(n));
+    std::mt19937 rng(1234);
+    for (auto& row : g)
+        for (auto& c : row) c.isMine = rng() % 100 < 16;
+    return g;
+}
+
+Grid MakeFlat(int n) {
+    Grid g(n, n);
+    std::mt19937 rng(1234);
+    for (int i = 0; i < n; i++)
+        for (int j = 0; j < n; j++) g.SetMine(g.Index(i, j), rng() % 100 < 16);
+    return g;
+}
+
+void LegacyCalculateNumbers(LegacyGrid& grid, int rows, int cols) {
+    int dx[8] = { -1, -1, -1, 0, 0, 1, 1, 1 };
+    int dy[8] = { -1, 0, 1, -1, 1, -1, 0, 1 };
+    for (int i = 0; i < rows; i++) {
+        for (int j = 0; j < cols; j++) {
+            if (!grid[i][j].isMine) {
+                int cnt = 0;
+                for (int d = 0; d < 8; d++) {
+                    int nx = i + dx[d];
+                    int ny = j + dy[d];
+                    if (nx >= 0 && nx < rows && ny >= 0 && ny < cols) {
+                        if (grid[nx][ny].isMine) cnt++;
+                    }
+                }
+                grid[i][j].adjacent = cnt;
+            }
+        }
+    }
+}
+
+void FlatCalculateNumbers(Grid& grid) {
+    const int* nb = grid.Neighbors();
+    uint8_t* cells = grid.Data();
+    for (int i = 0; i < grid.Rows(); i++) {
+        int idx = grid.Index(i, 0);
+        for (int j = 0; j < grid.Cols(); j++, idx++) {
+            int cnt = 0;
+            for (int d = 0; d < 8; d++) cnt += cells[idx + nb[d]] & Grid::MINE_BIT;
+            int keep = (cells[idx] & Grid::MINE_BIT) - 1;
+            cells[idx] = (uint8_t)((cells[idx] & ~Grid::ADJ_MASK) | ((cnt << Grid::ADJ_SHIFT) & keep));
+        }
+    }
+}
+
+void BM_LegacyCalculateNumbers(benchmark::State& state) {
+    int n = (int)state.range(0);
+    LegacyGrid g = MakeLegacy(n);
+    for (auto _ : state) {
+        LegacyCalculateNumbers(g, n, n);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * (int64_t)n * n);
+}
+
+void BM_FlatCalculateNumbers(benchmark::State& state) {
+    int n = (int)state.range(0);
+    Grid g = MakeFlat(n);
+    for (auto _ : state) {
+        FlatCalculateNumbers(g);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * (int64_t)n * n);
+}
+
+// Full-board scan with the same access pattern as CheckVictory / DrawGrid.
+void BM_LegacyScan(benchmark::State& state) {
+    int n = (int)state.range(0);
+    LegacyGrid g = MakeLegacy(n);
+    for (auto _ : state) {
+        int64_t sum = 0;
+        for (int i = 0; i < n; i++)
+            for (int j = 0; j < n; j++) {
+                const LegacyCell& c = g[i][j];
+                sum += c.isMine && c.state != CellState::Flagged;
+                sum += c.adjacent;
+            }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * (int64_t)n * n);
+}
+
+void BM_FlatScan(benchmark::State& state) {
+    int n = (int)state.range(0);
+    Grid g = MakeFlat(n);
+    for (auto _ : state) {
+        int64_t sum = 0;
+        for (int i = 0; i < n; i++) {
+            int idx = g.Index(i, 0);
+            for (int j = 0; j < n; j++, idx++) {
+                sum += g.IsMine(idx) && g.State(idx) != CellState::Flagged;
+                sum += g.Adjacent(idx);
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * (int64_t)n * n);
+}
+
+}
+
+BENCHMARK(BM_LegacyCalculateNumbers)->Arg(16)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_FlatCalculateNumbers)->Arg(16)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_LegacyScan)->Arg(16)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_FlatScan)->Arg(16)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,38 @@
+// Exact probabilities on positions where the solver is stuck and a guess is
+// needed, collected by playing solver moves on expert boards (30x16, 99).
+#include <benchmark/benchmark.h>
+#include "../probability.h"
+#include "../solver.h"
+#include <vector>
+
+namespace {
+
+std::vector<Game> StuckPositions(int count) {
+    std::vector<Game> positions;
+    Solver solver;
+    for (uint64_t seed = 1; (int)positions.size() < count; seed++) {
+        Game game(16, 30, 99, seed);
+        game.HandleClick(8, 15, true);
+        solver.Reset(game);
+        int row, col;
+        bool mine;
+        while (!game.gameOver && !game.victory && solver.Hint(game, row, col, mine)) game.HandleClick(row, col, !mine);
+        if (!game.gameOver && !game.victory) positions.push_back(game);
+    }
+    return positions;
+}
+
+void BM_ExpertProbabilities(benchmark::State& state) {
+    std::vector<Game> positions = StuckPositions(64);
+    ProbabilityEngine engine;
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(engine.Compute(positions[i]));
+        i = (i + 1) % positions.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+}
+
+BENCHMARK(BM_ExpertProbabilities)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,95 @@
+// Compares the old recursive Reveal/FloodReveal with Grid::FloodReveal.
+#include <benchmark/benchmark.h>
+#include "../grid.h"
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace {
+
+struct Board {
+    Grid grid;
+    std::vector<uint8_t> initial;
+    int start;
+};
+
+Board MakeBoard(int rows, int cols, int mines) {
+    Board b{ Grid(rows, cols), {}, 0 };
+    Grid& g = b.grid;
+    std::mt19937 rng(42);
+    int sr = rows / 2, sc = cols / 2;
+    int placed = 0;
+    while (placed < mines) {
+        int r = (int)(rng() % rows), c = (int)(rng() % cols);
+        if (abs(r - sr) <= 1 && abs(c - sc) <= 1) continue;
+        if (g.IsMine(r, c)) continue;
+        g.SetMine(g.Index(r, c), true);
+        placed++;
+    }
+    const int* nb = g.Neighbors();
+    for (int i = 0; i < rows; i++)
+        for (int j = 0; j < cols; j++) {
+            int idx = g.Index(i, j), cnt = 0;
+            for (int d = 0; d < 8; d++) cnt += g.IsMine(idx + nb[d]);
+            if (!g.IsMine(idx)) g.SetAdjacent(idx, cnt);
+        }
+    b.start = g.Index(sr, sc);
+    b.initial.assign(g.Data(), g.Data() + g.PaddedSize());
+    return b;
+}
+
+void RecursiveReveal(Grid& g, int row, int col, int& revealed);
+
+void RecursiveFlood(Grid& g, int row, int col, int& revealed) {
+    int dx[8] = { -1, -1, -1, 0, 0, 1, 1, 1 };
+    int dy[8] = { -1, 0, 1, -1, 1, -1, 0, 1 };
+    for (int d = 0; d < 8; d++) {
+        int nx = row + dx[d];
+        int ny = col + dy[d];
+        if (nx >= 0 && nx < g.Rows() && ny >= 0 && ny < g.Cols()) {
+            if (g.State(nx, ny) == CellState::Hidden) RecursiveReveal(g, nx, ny, revealed);
+        }
+    }
+}
+
+void RecursiveReveal(Grid& g, int row, int col, int& revealed) {
+    if (row < 0 || row >= g.Rows() || col < 0 || col >= g.Cols()) return;
+    int idx = g.Index(row, col);
+    if (g.State(idx) != CellState::Hidden) return;
+    g.SetState(idx, CellState::Revealed);
+    if (g.IsMine(idx)) return;
+    revealed++;
+    if (g.Adjacent(idx) == 0) RecursiveFlood(g, row, col, revealed);
+}
+
+void BM_RecursiveReveal(benchmark::State& state) {
+    Board b = MakeBoard((int)state.range(0), (int)state.range(1), (int)state.range(2));
+    int revealed = 0;
+    for (auto _ : state) {
+        memcpy(b.grid.Data(), b.initial.data(), b.initial.size());
+        revealed = 0;
+        RecursiveReveal(b.grid, b.grid.RowOf(b.start), b.grid.ColOf(b.start), revealed);
+        benchmark::DoNotOptimize(revealed);
+    }
+    state.counters["revealed"] = revealed;
+}
+
+void BM_IterativeReveal(benchmark::State& state) {
+    Board b = MakeBoard((int)state.range(0), (int)state.range(1), (int)state.range(2));
+    std::vector<int> work;
+    int revealed = 0;
+    for (auto _ : state) {
+        memcpy(b.grid.Data(), b.initial.data(), b.initial.size());
+        b.grid.SetState(b.start, CellState::Revealed);
+        revealed = 1 + b.grid.FloodReveal(b.start, work);
+        benchmark::DoNotOptimize(revealed);
+    }
+    state.counters["revealed"] = revealed;
+}
+
+}
+
+// The recursive version is only run where its depth stays within a default stack.
+BENCHMARK(BM_RecursiveReveal)->Args({ 9, 9, 10 })->Args({ 16, 16, 40 })->Args({ 128, 128, 0 });
+BENCHMARK(BM_IterativeReveal)->Args({ 9, 9, 10 })->Args({ 16, 16, 40 })->Args({ 128, 128, 0 })
+    ->Args({ 2000, 2000, 40000 })->Args({ 4000, 4000, 0 })->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,30 @@
+// Random number throughput: the C library rand() against Xoshiro256, single
+// threaded and with every thread drawing at once.
+#include <benchmark/benchmark.h>
+#include "../rng.h"
+#include <cstdlib>
+
+namespace {
+
+void BM_Rand(benchmark::State& state) {
+    int n = (int)state.range(0);
+    srand(1);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(rand() % n);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_Xoshiro(benchmark::State& state) {
+    uint64_t n = (uint64_t)state.range(0);
+    Xoshiro256 rng(1 + state.thread_index());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(rng.Below(n));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+}
+
+BENCHMARK(BM_Rand)->Arg(16)->Arg(10000)->ThreadRange(1, 8);
+BENCHMARK(BM_Xoshiro)->Arg(16)->Arg(10000)->ThreadRange(1, 8);
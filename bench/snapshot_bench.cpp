@@ -0,0 +1,71 @@
+// Saving and resuming half-played large boards, with and without run-length
+// encoded layers. Loads go through the file, so they include the mmap.
+#include <benchmark/benchmark.h>
+#include "../snapshot.h"
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+namespace {
+
+// Opens safe cells and flags mines on an n x n board until about half of
+// it is settled.
+Game HalfPlayed(int n) {
+    Game game(n, n, n * n / 6, 11);
+    game.HandleClick(n / 2, n / 2, true);
+    Xoshiro256 rng(5);
+    while (game.revealedCnt < n * n / 3 && !game.victory) {
+        int r = (int)rng.Below((uint64_t)n), c = (int)rng.Below((uint64_t)n);
+        int idx = game.grid.Index(r, c);
+        if (game.grid.State(idx) != CellState::Hidden) continue;
+        game.HandleClick(r, c, !game.grid.IsMine(idx));
+    }
+    game.clock.Reset(123.5);
+    return game;
+}
+
+bool SameBoard(const Game& a, const Game& b) {
+    return a.rows == b.rows && a.cols == b.cols && a.flagsLeft == b.flagsLeft && a.revealedCnt == b.revealedCnt &&
+           a.clock.Seconds({}) == b.clock.Seconds({}) && a.flaggedMines == b.flaggedMines && a.wrongFlags == b.wrongFlags &&
+           memcmp(a.grid.Data(), b.grid.Data(), (size_t)a.grid.PaddedSize()) == 0;
+}
+
+void BM_SaveSnapshot(benchmark::State& state) {
+    Game game = HalfPlayed((int)state.range(0));
+    bool compress = state.range(1) != 0;
+    std::vector<uint8_t> bytes;
+    for (auto _ : state) {
+        WriteSnapshot(game, bytes, compress);
+        benchmark::DoNotOptimize(bytes.data());
+    }
+    state.counters["bytes"] = (double)bytes.size();
+    state.SetItemsProcessed(state.iterations() * game.rows * game.cols);
+}
+
+void BM_LoadSnapshot(benchmark::State& state) {
+    int n = (int)state.range(0);
+    bool compress = state.range(1) != 0;
+    Game game = HalfPlayed(n);
+    std::string path = "snapshot_bench_" + std::to_string(n) + (compress ? "_rle" : "_raw") + ".mss";
+    if (!SaveSnapshot(game, path, compress)) {
+        state.SkipWithError("cannot write snapshot");
+        return;
+    }
+    Game loaded;
+    // Doubles as the round-trip check: every load must give back the board.
+    if (!LoadSnapshot(loaded, path) || !SameBoard(game, loaded)) {
+        state.SkipWithError("snapshot did not round-trip");
+        remove(path.c_str());
+        return;
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(LoadSnapshot(loaded, path));
+    }
+    remove(path.c_str());
+    state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+}
+
+BENCHMARK(BM_SaveSnapshot)->Args({ 16, 1 })->Args({ 1000, 0 })->Args({ 1000, 1 })->Args({ 4000, 0 })->Args({ 4000, 1 })->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LoadSnapshot)->Args({ 16, 1 })->Args({ 1000, 0 })->Args({ 1000, 1 })->Args({ 4000, 0 })->Args({ 4000, 1 })->Unit(benchmark::kMillisecond);
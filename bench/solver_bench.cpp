@@ -0,0 +1,62 @@
+// Solver cost per move at expert density (99 mines in 480 cells) on n x n
+// boards: incremental Sync against rebuilding the solver after every move.
+// Each iteration plays one whole game; items are moves, so the reported
+// time per item is the cost of a move including the reveal itself.
+#include <benchmark/benchmark.h>
+#include "../bot.h"
+
+namespace {
+
+int ExpertMines(int n) {
+    return n * n * 99 / 480;
+}
+
+void BM_SolverIncremental(benchmark::State& state) {
+    int n = (int)state.range(0);
+    Game game(n, n, ExpertMines(n), 1);
+    SolverBot bot(1);
+    long long moves = 0;
+    for (auto _ : state) {
+        game.NewGame();
+        bot.NewGame(game);
+        while (!game.gameOver && !game.victory) {
+            Move m = bot.NextMove(game);
+            game.HandleClick(m.row, m.col, m.leftClick);
+            moves++;
+        }
+    }
+    state.SetItemsProcessed(moves);
+}
+
+void BM_SolverFromScratch(benchmark::State& state) {
+    int n = (int)state.range(0);
+    Game game(n, n, ExpertMines(n), 1);
+    Xoshiro256 rng(1);
+    Solver solver;
+    long long moves = 0;
+    for (auto _ : state) {
+        game.NewGame();
+        game.HandleClick(n / 2, n / 2, true);
+        moves++;
+        while (!game.gameOver && !game.victory) {
+            solver.Reset(game);
+            int row, col;
+            bool mine;
+            if (!solver.Hint(game, row, col, mine)) {
+                mine = false;
+                do {
+                    row = (int)rng.Below((uint64_t)n);
+                    col = (int)rng.Below((uint64_t)n);
+                } while (game.grid.State(row, col) != CellState::Hidden);
+            }
+            game.HandleClick(row, col, !mine);
+            moves++;
+        }
+    }
+    state.SetItemsProcessed(moves);
+}
+
+}
+
+BENCHMARK(BM_SolverIncremental)->Arg(16)->Arg(100)->Arg(1000);
+BENCHMARK(BM_SolverFromScratch)->Arg(16)->Arg(100);
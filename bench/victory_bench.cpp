@@ -0,0 +1,45 @@
+// Clicks per second on large boards with incremental victory tracking,
+// against the full-board scan it replaces.
+#include <benchmark/benchmark.h>
+#include "../game.h"
+#include <cstdlib>
+
+namespace {
+
+// Cycles hidden -> flagged -> questioned -> hidden on random cells.
+void BM_RightClicks(benchmark::State& state) {
+    int n = (int)state.range(0);
+    Game game(n, n, n * n / 6);
+    srand(7);
+    game.HandleClick(n / 2, n / 2, true);
+    for (auto _ : state) {
+        game.HandleClick(rand() % n, rand() % n, false);
+        if (game.victory) game.victory = false;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Worst case for the scan: every mine but the last one is flagged.
+void BM_FullScanVictory(benchmark::State& state) {
+    int n = (int)state.range(0);
+    Game game(n, n, n * n / 6);
+    srand(7);
+    game.HandleClick(n / 2, n / 2, true);
+    int last = -1;
+    for (int i = 0; i < n; i++)
+        for (int j = 0; j < n; j++) {
+            int idx = game.grid.Index(i, j);
+            if (!game.grid.IsMine(idx)) continue;
+            if (last >= 0) game.grid.SetState(last, CellState::Flagged);
+            last = idx;
+        }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(game.CheckVictoryFullScan());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+}
+
+BENCHMARK(BM_RightClicks)->Arg(16)->Arg(1000)->Arg(4000);
+BENCHMARK(BM_FullScanVictory)->Arg(16)->Arg(1000)->Arg(4000);
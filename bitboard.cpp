@@ -0,0 +1,24 @@
+#include "bitboard.h"
+#include <algorithm>
+#include <bitset>
+
+Bitboard::Bitboard(int r, int c) {
+    Resize(r, c);
+}
+
+void Bitboard::Resize(int r, int c) {
+    rows = r;
+    cols = c;
+    wordsPerRow = (cols + 63) / 64;
+    words.assign((size_t)rows * wordsPerRow, 0);
+}
+
+void Bitboard::Clear() {
+    std::fill(words.begin(), words.end(), 0);
+}
+
+long long Bitboard::Count() const {
+    long long n = 0;
+    for (uint64_t w : words) n += (long long)std::bitset<64>(w).count();
+    return n;
+}
@@ -0,0 +1,95 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+inline int LowestBit(uint64_t x) {
+#if defined(_MSC_VER)
+    unsigned long i;
+    _BitScanForward64(&i, x);
+    return (int)i;
+#else
+    return __builtin_ctzll(x);
+#endif
+}
+
+inline int PopCount(uint64_t x) {
+#if defined(_MSC_VER)
+    return (int)__popcnt64(x);
+#else
+    return __builtin_popcountll(x);
+#endif
+}
+
+// One bit per cell, 64 cells per word, each row starting on a new word.
+class Bitboard {
+public:
+    Bitboard(int rows = 0, int cols = 0);
+    void Resize(int rows, int cols);
+    void Clear();
+
+    int Rows() const { return rows; }
+    int Cols() const { return cols; }
+    int WordsPerRow() const { return wordsPerRow; }
+
+    bool Test(int row, int col) const { return (words[Word(row, col)] >> (col & 63)) & 1; }
+    void Set(int row, int col) { words[Word(row, col)] |= 1ULL << (col & 63); }
+    void Reset(int row, int col) { words[Word(row, col)] &= ~(1ULL << (col & 63)); }
+    long long Count() const;
+
+    const uint64_t* RowWords(int row) const { return words.data() + (size_t)row * wordsPerRow; }
+    uint64_t* RowWords(int row) { return words.data() + (size_t)row * wordsPerRow; }
+
+    // Sets `count` distinct bits chosen uniformly among all cells outside the
+    // 3x3 block around (safeRow, safeCol). Uses Floyd's form of a partial
+    // Fisher-Yates shuffle with the bitboard itself as the membership set:
+    // exactly one draw per mine, no rejection loop and no index array.
+    // below(n) must return a uniform integer in [0, n). Returns bits placed.
+    template <class Below>
+    int PlaceRandom(int count, int safeRow, int safeCol, Below&& below);
+
+private:
+    size_t Word(int row, int col) const { return (size_t)row * wordsPerRow + (col >> 6); }
+
+    int rows = 0;
+    int cols = 0;
+    int wordsPerRow = 0;
+    std::vector<uint64_t> words;
+};
+
+template <class Below>
+int Bitboard::PlaceRandom(int count, int safeRow, int safeCol, Below&& below) {
+    int r0 = safeRow > 0 ? safeRow - 1 : 0;
+    int r1 = safeRow + 1 < rows ? safeRow + 1 : rows - 1;
+    int c0 = safeCol > 0 ? safeCol - 1 : 0;
+    int c1 = safeCol + 1 < cols ? safeCol + 1 : cols - 1;
+    long long h = r1 - r0 + 1;
+    long long w = c1 - c0 + 1;
+    long long blockStart = (long long)r0 * cols + c0;
+    long long bandAllowed = h * (cols - w);
+    long long allowed = (long long)rows * cols - h * w;
+    if (count > allowed) count = (int)allowed;
+
+    // Maps the k-th allowed cell to its row-major position, skipping the block.
+    auto cellOf = [&](long long k) {
+        if (k < blockStart) return k;
+        long long rest = k - blockStart;
+        if (rest < bandAllowed) return blockStart + (rest / (cols - w)) * cols + w + rest % (cols - w);
+        return blockStart + h * cols + (rest - bandAllowed);
+    };
+
+    for (long long j = allowed - count; j < allowed; j++) {
+        long long cell = cellOf((long long)below(j + 1));
+        int r = (int)(cell / cols), c = (int)(cell % cols);
+        if (Test(r, c)) {
+            cell = cellOf(j);
+            r = (int)(cell / cols);
+            c = (int)(cell % cols);
+        }
+        Set(r, c);
+    }
+    return count;
+}
@@ -0,0 +1,15 @@
+#include "board.h"
+
+bool DynamicBoard::HandleClick(int row, int col, bool leftClick) {
+    size_t moves = game.log.Moves();
+    game.HandleClick(row, col, leftClick);
+    return game.log.Moves() != moves;
+}
+
+std::unique_ptr<Minefield> MakeBoard(int rows, int cols, int mines, uint64_t seed, bool fixed) {
+    if (fixed && rows == NormalBoard::ROWS && cols == NormalBoard::COLS && mines == NormalBoard::MINES)
+        return std::unique_ptr<Minefield>(new NormalBoard(seed));
+    if (fixed && rows == HardBoard::ROWS && cols == HardBoard::COLS && mines == HardBoard::MINES)
+        return std::unique_ptr<Minefield>(new HardBoard(seed));
+    return std::unique_ptr<Minefield>(new DynamicBoard(rows, cols, mines, seed));
+}
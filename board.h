@@ -0,0 +1,304 @@
+#pragma once
+#include "game.h"
+#include "grid.h"
+#include "rng.h"
+#include <array>
+#include <cstdint>
+#include <memory>
+
+// A game as a player sees it, whatever holds the board: the compile-time
+// Board below for the presets or DynamicBoard (a Game) for any size. Calls
+// are per move, so the virtual dispatch is not on any per-cell path. Cells
+// use Grid's byte layout and one-cell border, so readers index them with
+// Stride() and the Neighbors() offsets like a Grid.
+class Minefield {
+public:
+    virtual ~Minefield() {}
+
+    virtual int Rows() const = 0;
+    virtual int Cols() const = 0;
+    virtual int Mines() const = 0;
+    virtual uint64_t Seed() const = 0;
+
+    virtual void NewGame(uint64_t seed) = 0;
+    // Same rules as Game::HandleClick, chords included. Returns whether the
+    // board changed.
+    virtual bool HandleClick(int row, int col, bool leftClick) = 0;
+
+    virtual bool GameOver() const = 0;
+    virtual bool Victory() const = 0;
+    virtual bool FirstClick() const = 0;
+    virtual int Revealed() const = 0;
+    virtual int FlagsLeft() const = 0;
+
+    virtual const uint8_t* Cells() const = 0;
+    virtual int Stride() const = 0;
+    virtual const int* Neighbors() const = 0;
+
+    int Index(int row, int col) const { return (row + 1) * Stride() + col + 1; }
+    CellState State(int row, int col) const { return (CellState)((Cells()[Index(row, col)] & Grid::STATE_MASK) >> Grid::STATE_SHIFT); }
+    int Adjacent(int row, int col) const { return (Cells()[Index(row, col)] & Grid::ADJ_MASK) >> Grid::ADJ_SHIFT; }
+};
+
+// A board whose size and mine count are template arguments: storage is a
+// std::array, the neighbor offsets are constexpr and every loop bound is a
+// constant the compiler can unroll or vectorise. Plays exactly like Game,
+// mine layout included (same seed, same first click, same board), but keeps
+// no undo history or move log.
+template <int ROWS_, int COLS_, int MINES_>
+class Board : public Minefield {
+public:
+    static constexpr int ROWS = ROWS_;
+    static constexpr int COLS = COLS_;
+    static constexpr int MINES = MINES_;
+    static constexpr int STRIDE = COLS + 2;
+    static constexpr int SIZE = (ROWS + 2) * STRIDE;
+    static_assert(ROWS >= 3 && COLS >= 3 && MINES >= 0 && MINES <= ROWS * COLS - 9, "mines must leave room for the first click");
+
+    // Same order as Grid::Neighbors.
+    static constexpr std::array<int, 8> NEIGHBORS = { { -STRIDE - 1, -STRIDE, -STRIDE + 1, -1, 1, STRIDE - 1, STRIDE, STRIDE + 1 } };
+
+    explicit Board(uint64_t seed = 0) { NewGame(seed); }
+
+    int Rows() const override { return ROWS; }
+    int Cols() const override { return COLS; }
+    int Mines() const override { return MINES; }
+    uint64_t Seed() const override { return seed; }
+
+    void NewGame(uint64_t s) override {
+        seed = s;
+        cells.fill((uint8_t)Grid::BORDER_CELL);
+        for (int r = 1; r <= ROWS; r++)
+            for (int c = 1; c <= COLS; c++) cells[r * STRIDE + c] = 0;
+        revealed = 0;
+        flagsLeft = MINES;
+        flaggedMines = 0;
+        wrongFlags = 0;
+        gameOver = false;
+        victory = false;
+        firstClick = true;
+    }
+
+    bool HandleClick(int row, int col, bool leftClick) override;
+
+    bool GameOver() const override { return gameOver; }
+    bool Victory() const override { return victory; }
+    bool FirstClick() const override { return firstClick; }
+    int Revealed() const override { return revealed; }
+    int FlagsLeft() const override { return flagsLeft; }
+
+    const uint8_t* Cells() const override { return cells.data(); }
+    int Stride() const override { return STRIDE; }
+    const int* Neighbors() const override { return NEIGHBORS.data(); }
+
+private:
+    static constexpr uint8_t REVEALED = (uint8_t)((int)CellState::Revealed << Grid::STATE_SHIFT);
+
+    static CellState StateOf(uint8_t cell) { return (CellState)((cell & Grid::STATE_MASK) >> Grid::STATE_SHIFT); }
+    void SetState(int idx, CellState s) { cells[idx] = (uint8_t)((cells[idx] & ~Grid::STATE_MASK) | ((int)s << Grid::STATE_SHIFT)); }
+
+    void PlaceMines(int row, int col);
+    int Flood(int sp);
+    bool Reveal(int idx);
+    bool Chord(int idx);
+    bool Mark(int idx);
+
+    std::array<uint8_t, SIZE> cells;
+    // Flood stack; every cell is pushed at most once.
+    std::array<int, ROWS * COLS> work;
+    Xoshiro256 rng;
+    uint64_t seed = 0;
+    int revealed = 0;
+    int flagsLeft = MINES;
+    int flaggedMines = 0;
+    int wrongFlags = 0;
+    bool gameOver = false;
+    bool victory = false;
+    bool firstClick = true;
+};
+
+// The same draws as Bitboard::PlaceRandom, so the layout matches Game's.
+template <int R, int C, int M>
+void Board<R, C, M>::PlaceMines(int row, int col) {
+    int r0 = row > 0 ? row - 1 : 0, r1 = row + 1 < ROWS ? row + 1 : ROWS - 1;
+    int c0 = col > 0 ? col - 1 : 0, c1 = col + 1 < COLS ? col + 1 : COLS - 1;
+    int h = r1 - r0 + 1, w = c1 - c0 + 1;
+    int blockStart = r0 * COLS + c0;
+    int bandAllowed = h * (COLS - w);
+    int allowed = ROWS * COLS - h * w;
+    auto cellOf = [&](int k) {
+        if (k < blockStart) return k;
+        int rest = k - blockStart;
+        if (rest < bandAllowed) return blockStart + (rest / (COLS - w)) * COLS + w + rest % (COLS - w);
+        return blockStart + h * COLS + (rest - bandAllowed);
+    };
+
+    rng.Seed(seed);
+    for (int j = allowed - MINES; j < allowed; j++) {
+        int cell = cellOf((int)rng.Below((uint64_t)j + 1));
+        int idx = (cell / COLS + 1) * STRIDE + cell % COLS + 1;
+        if (cells[idx] & Grid::MINE_BIT) {
+            cell = cellOf(j);
+            idx = (cell / COLS + 1) * STRIDE + cell % COLS + 1;
+        }
+        cells[idx] |= Grid::MINE_BIT;
+    }
+
+    flaggedMines = 0;
+    wrongFlags = 0;
+    for (int r = 1; r <= ROWS; r++) {
+        for (int c = 1; c <= COLS; c++) {
+            int idx = r * STRIDE + c;
+            int count = 0;
+            for (int d = 0; d < 8; d++) count += cells[idx + NEIGHBORS[d]] & Grid::MINE_BIT;
+            int keep = (cells[idx] & Grid::MINE_BIT) - 1;
+            cells[idx] = (uint8_t)((cells[idx] & ~Grid::ADJ_MASK) | ((count << Grid::ADJ_SHIFT) & keep));
+            // Flags placed before the first click count from here on.
+            if (StateOf(cells[idx]) == CellState::Flagged) {
+                if (cells[idx] & Grid::MINE_BIT) flaggedMines++;
+                else wrongFlags++;
+            }
+        }
+    }
+}
+
+// Pops the sp zero cells on the stack and reveals the openings around them.
+template <int R, int C, int M>
+int Board<R, C, M>::Flood(int sp) {
+    const uint8_t ZERO_MASK = Grid::ADJ_MASK | Grid::MINE_BIT;
+    int count = 0;
+    while (sp > 0) {
+        int cur = work[--sp];
+        for (int d = 0; d < 8; d++) {
+            int n = cur + NEIGHBORS[d];
+            if (cells[n] & Grid::STATE_MASK) continue;
+            cells[n] |= REVEALED;
+            count++;
+            if ((cells[n] & ZERO_MASK) == 0) work[sp++] = n;
+        }
+    }
+    return count;
+}
+
+template <int R, int C, int M>
+bool Board<R, C, M>::Reveal(int idx) {
+    cells[idx] |= REVEALED;
+    if (cells[idx] & Grid::MINE_BIT) {
+        gameOver = true;
+        return true;
+    }
+    revealed++;
+    if ((cells[idx] & Grid::ADJ_MASK) == 0) {
+        work[0] = idx;
+        revealed += Flood(1);
+    }
+    return true;
+}
+
+template <int R, int C, int M>
+bool Board<R, C, M>::Chord(int idx) {
+    int adjacent = (cells[idx] & Grid::ADJ_MASK) >> Grid::ADJ_SHIFT;
+    if (adjacent == 0) return false;
+    int flags = 0, mine = -1, sp = 0, opened = 0;
+    for (int d = 0; d < 8; d++) {
+        CellState s = StateOf(cells[idx + NEIGHBORS[d]]);
+        flags += s == CellState::Flagged;
+    }
+    if (flags != adjacent) return false;
+    for (int d = 0; d < 8; d++) {
+        int n = idx + NEIGHBORS[d];
+        if (cells[n] & Grid::STATE_MASK) continue;
+        if (cells[n] & Grid::MINE_BIT) {
+            mine = n;
+            continue;
+        }
+        cells[n] |= REVEALED;
+        opened++;
+        if ((cells[n] & Grid::ADJ_MASK) == 0) work[sp++] = n;
+    }
+    if (opened == 0 && mine < 0) return false;
+    revealed += opened + Flood(sp);
+    if (mine >= 0) {
+        cells[mine] |= REVEALED;
+        gameOver = true;
+    }
+    return true;
+}
+
+template <int R, int C, int M>
+bool Board<R, C, M>::Mark(int idx) {
+    CellState s = StateOf(cells[idx]);
+    bool mine = (cells[idx] & Grid::MINE_BIT) != 0;
+    switch (s) {
+    case CellState::Hidden:
+        if (flagsLeft == 0) return false;
+        flagsLeft--;
+        (mine ? flaggedMines : wrongFlags)++;
+        SetState(idx, CellState::Flagged);
+        return true;
+    case CellState::Flagged:
+        flagsLeft++;
+        (mine ? flaggedMines : wrongFlags)--;
+        SetState(idx, CellState::Questioned);
+        return true;
+    case CellState::Questioned:
+        SetState(idx, CellState::Hidden);
+        return true;
+    default:
+        return false;
+    }
+}
+
+template <int R, int C, int M>
+bool Board<R, C, M>::HandleClick(int row, int col, bool leftClick) {
+    if (gameOver || victory) return false;
+    if (row < 0 || row >= ROWS || col < 0 || col >= COLS) return false;
+    int idx = (row + 1) * STRIDE + col + 1;
+    bool changed;
+    if (!leftClick) changed = Mark(idx);
+    else if (StateOf(cells[idx]) == CellState::Revealed) changed = Chord(idx);
+    else if (StateOf(cells[idx]) != CellState::Hidden) changed = false;
+    else {
+        if (firstClick) {
+            PlaceMines(row, col);
+            firstClick = false;
+        }
+        changed = Reveal(idx);
+    }
+    if (changed && !gameOver && !firstClick)
+        victory = revealed == ROWS * COLS - MINES || (flaggedMines == MINES && wrongFlags == 0);
+    return changed;
+}
+
+// The dynamic Game behind the Minefield interface, for any size.
+class DynamicBoard : public Minefield {
+public:
+    DynamicBoard(int rows, int cols, int mines, uint64_t seed = 0) : game(rows, cols, mines, seed) {}
+
+    int Rows() const override { return game.rows; }
+    int Cols() const override { return game.cols; }
+    int Mines() const override { return game.mineCount; }
+    uint64_t Seed() const override { return game.seed; }
+
+    void NewGame(uint64_t seed) override { game.NewGame(seed); }
+    bool HandleClick(int row, int col, bool leftClick) override;
+
+    bool GameOver() const override { return game.gameOver; }
+    bool Victory() const override { return game.victory; }
+    bool FirstClick() const override { return game.firstClick; }
+    int Revealed() const override { return game.revealedCnt; }
+    int FlagsLeft() const override { return game.flagsLeft; }
+
+    const uint8_t* Cells() const override { return game.grid.Data(); }
+    int Stride() const override { return game.grid.Stride(); }
+    const int* Neighbors() const override { return game.grid.Neighbors(); }
+
+    Game game;
+};
+
+typedef Board<9, 9, 10> NormalBoard;
+typedef Board<16, 16, 40> HardBoard;
+
+// A compile-time Board when the size is one of the presets and fixed is
+// set, a DynamicBoard otherwise.
+std::unique_ptr<Minefield> MakeBoard(int rows, int cols, int mines, uint64_t seed, bool fixed = true);
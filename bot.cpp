@@ -0,0 +1,78 @@
+#include "bot.h"
+
+BoardView::BoardView(const Game& game)
+    : cells(game.grid.Data()), neighbors(game.grid.Neighbors()), rows(game.rows), cols(game.cols),
+      stride(game.grid.Stride()), firstClick(game.firstClick) {}
+
+BoardView::BoardView(const Minefield& board)
+    : cells(board.Cells()), neighbors(board.Neighbors()), rows(board.Rows()), cols(board.Cols()),
+      stride(board.Stride()), firstClick(board.FirstClick()) {}
+
+Move RandomBot::Next(const BoardView& view) {
+    if (view.firstClick) return Move{ view.rows / 2, view.cols / 2, true };
+    return RandomHidden(view);
+}
+
+Move RandomBot::RandomHidden(const BoardView& view) {
+    for (int tries = 0; tries < 64; tries++) {
+        int r = (int)rng.Below((uint64_t)view.rows);
+        int c = (int)rng.Below((uint64_t)view.cols);
+        if (view.State(view.Index(r, c)) == CellState::Hidden) return Move{ r, c, true };
+    }
+    for (int i = 0; i < view.rows; i++) {
+        for (int j = 0; j < view.cols; j++) {
+            if (view.State(view.Index(i, j)) == CellState::Hidden) return Move{ i, j, true };
+        }
+    }
+    return Move{ 0, 0, true };
+}
+
+Move SimpleBot::Next(const BoardView& view) {
+    if (view.firstClick) return Move{ view.rows / 2, view.cols / 2, true };
+
+    const int* nb = view.neighbors;
+    for (int i = 0; i < view.rows; i++) {
+        int idx = view.Index(i, 0);
+        for (int j = 0; j < view.cols; j++, idx++) {
+            if (view.State(idx) != CellState::Revealed || view.Adjacent(idx) == 0) continue;
+            int hidden = 0, flagged = 0, target = -1;
+            for (int d = 0; d < 8; d++) {
+                CellState s = view.State(idx + nb[d]);
+                if (s == CellState::Flagged) flagged++;
+                else if (s == CellState::Hidden) { hidden++; target = idx + nb[d]; }
+            }
+            if (hidden == 0) continue;
+            int adjacent = view.Adjacent(idx);
+            if (adjacent == flagged) return Move{ view.RowOf(target), view.ColOf(target), true };
+            if (adjacent == flagged + hidden) return Move{ view.RowOf(target), view.ColOf(target), false };
+        }
+    }
+    return RandomHidden(view);
+}
+
+void SolverBot::NewGame(const Game& game) {
+    RandomBot::NewGame(game);
+    solver.Reset(game);
+}
+
+Move SolverBot::NextMove(const Game& game) {
+    if (game.firstClick) return Move{ game.rows / 2, game.cols / 2, true };
+
+    int row, col;
+    bool mine;
+    if (!solver.Hint(game, row, col, mine)) {
+        probs.Compute(game);
+        if (probs.BestGuess(game, row, col)) return Move{ row, col, true };
+        return RandomHidden(BoardView(game));
+    }
+    // A safe cell under a question mark takes a right click to clear first.
+    if (!mine && game.grid.State(row, col) != CellState::Hidden) return Move{ row, col, false };
+    return Move{ row, col, !mine };
+}
+
+std::unique_ptr<Bot> MakeBot(const std::string& name, uint64_t seed) {
+    if (name == "random") return std::unique_ptr<Bot>(new RandomBot(seed));
+    if (name == "simple") return std::unique_ptr<Bot>(new SimpleBot(seed));
+    if (name == "solver") return std::unique_ptr<Bot>(new SolverBot(seed));
+    return nullptr;
+}
@@ -0,0 +1,102 @@
+#pragma once
+#include "board.h"
+#include "game.h"
+#include "probability.h"
+#include "solver.h"
+#include <memory>
+#include <string>
+
+struct Move {
+    int row;
+    int col;
+    bool leftClick;
+};
+
+// The cells a bot reads, from a Game or any Minefield.
+struct BoardView {
+    const uint8_t* cells;
+    const int* neighbors;
+    int rows;
+    int cols;
+    int stride;
+    bool firstClick;
+
+    explicit BoardView(const Game& game);
+    explicit BoardView(const Minefield& board);
+
+    int Index(int row, int col) const { return (row + 1) * stride + col + 1; }
+    int RowOf(int idx) const { return idx / stride - 1; }
+    int ColOf(int idx) const { return idx % stride - 1; }
+    CellState State(int idx) const { return (CellState)((cells[idx] & Grid::STATE_MASK) >> Grid::STATE_SHIFT); }
+    int Adjacent(int idx) const { return (cells[idx] & Grid::ADJ_MASK) >> Grid::ADJ_SHIFT; }
+};
+
+// A player for headless games. NextMove is only called while the game is
+// still running and must return a move that changes the board. Bots that
+// only read cells can also play a Minefield, such as the compile-time
+// preset boards, and make the same moves there as on the same Game.
+class Bot {
+public:
+    virtual ~Bot() {}
+    virtual const char* Name() const = 0;
+    virtual void NewGame(const Game&) {}
+    virtual Move NextMove(const Game& game) = 0;
+
+    virtual bool PlaysMinefield() const { return false; }
+    virtual void NewGame(const Minefield&) {}
+    virtual Move NextMove(const Minefield&) { return Move{ 0, 0, true }; }
+};
+
+// Reveals uniformly random hidden cells. Reseeds from the board seed on
+// every game, so a game is reproducible from the seed alone. The seed is
+// mixed first: the mines were placed from the board seed itself, and the
+// same stream would make the guesses follow the mines.
+class RandomBot : public Bot {
+public:
+    explicit RandomBot(uint64_t seed) : rng(seed) {}
+    const char* Name() const override { return "random"; }
+    void NewGame(const Game& game) override { Reseed(game.GetSeed()); }
+    Move NextMove(const Game& game) override { return Next(BoardView(game)); }
+
+    bool PlaysMinefield() const override { return true; }
+    void NewGame(const Minefield& board) override { Reseed(board.Seed()); }
+    Move NextMove(const Minefield& board) override { return Next(BoardView(board)); }
+
+protected:
+    void Reseed(uint64_t seed) {
+        uint64_t s = seed ^ 0x9E3779B97F4A7C15ULL;
+        rng.Seed(SplitMix64(s));
+    }
+    virtual Move Next(const BoardView& view);
+    Move RandomHidden(const BoardView& view);
+    Xoshiro256 rng;
+};
+
+// Applies the single-cell rule around revealed numbers and guesses randomly
+// when it finds nothing.
+class SimpleBot : public RandomBot {
+public:
+    explicit SimpleBot(uint64_t seed) : RandomBot(seed) {}
+    const char* Name() const override { return "simple"; }
+
+protected:
+    Move Next(const BoardView& view) override;
+};
+
+// Plays every move the constraint solver can prove; when it is stuck,
+// reveals the cell with the lowest exact mine probability.
+class SolverBot : public RandomBot {
+public:
+    explicit SolverBot(uint64_t seed) : RandomBot(seed) {}
+    const char* Name() const override { return "solver"; }
+    void NewGame(const Game& game) override;
+    Move NextMove(const Game& game) override;
+    // The solver keeps state about a Game.
+    bool PlaysMinefield() const override { return false; }
+
+private:
+    Solver solver;
+    ProbabilityEngine probs;
+};
+
+std::unique_ptr<Bot> MakeBot(const std::string& name, uint64_t seed);
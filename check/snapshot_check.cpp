@@ -0,0 +1,135 @@
+// Round-trips a few thousand saved games through WriteSnapshot and
+// ReadSnapshot, with and without run-length encoding, and checks that
+// truncated snapshots and impossible board sizes are rejected without
+// touching the game loaded into. Exits non-zero on a mismatch; run by
+// ctest as snapshot-check.
+#include "../snapshot.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <vector>
+
+namespace {
+
+const int POSITIONS = 3000;
+
+// A game of random size played for a random number of random moves, so the
+// positions cover unplaced boards, half-played ones, losses and wins.
+Game RandomPosition(Xoshiro256& rng, int i) {
+    int rows = 1 + (int)rng.Below(40), cols = 1 + (int)rng.Below(40);
+    int cells = rows * cols;
+    // The first click keeps its 3x3 neighborhood free of mines.
+    int mines = cells > 9 ? (int)rng.Below((uint64_t)std::min(cells / 3, cells - 9) + 1) : 0;
+    Game game(rows, cols, mines, rng.Next());
+    int moves = i % 10 == 0 ? 0 : (int)rng.Below((uint64_t)cells * 2);
+    for (int m = 0; m < moves && !game.gameOver && !game.victory; m++) {
+        int r = (int)rng.Below((uint64_t)rows), c = (int)rng.Below((uint64_t)cols);
+        // Mostly safe reveals, so games get far before they are lost.
+        bool left = rng.Below(4) != 0;
+        if (left && game.minesPlaced && game.grid.IsMine(game.grid.Index(r, c)) && rng.Below(8) != 0) left = false;
+        game.HandleClick(r, c, left);
+        if (rng.Below(16) == 0) game.Undo();
+    }
+    game.clock.Reset((double)(i % 4000) * 0.25);
+    return game;
+}
+
+bool SameLog(const MoveLog& a, const MoveLog& b) {
+    std::vector<uint8_t> x, y;
+    a.Serialize(x);
+    b.Serialize(y);
+    return x == y;
+}
+
+bool SameGame(const Game& a, const Game& b) {
+    return a.rows == b.rows && a.cols == b.cols && a.mineCount == b.mineCount && a.seed == b.seed &&
+           a.flagsLeft == b.flagsLeft && a.revealedCnt == b.revealedCnt && a.flaggedMines == b.flaggedMines &&
+           a.wrongFlags == b.wrongFlags && a.clock.Seconds({}) == b.clock.Seconds({}) && a.gameOver == b.gameOver &&
+           a.victory == b.victory && a.firstClick == b.firstClick && a.minesPlaced == b.minesPlaced &&
+           a.explodedRow == b.explodedRow && a.explodedCol == b.explodedCol &&
+           a.grid.PaddedSize() == b.grid.PaddedSize() &&
+           memcmp(a.grid.Data(), b.grid.Data(), (size_t)a.grid.PaddedSize()) == 0 && SameLog(a.log, b.log);
+}
+
+}
+
+int main() {
+    Xoshiro256 rng(2024);
+    std::vector<uint8_t> bytes;
+    int failures = 0;
+    for (int i = 0; i < POSITIONS && failures < 10; i++) {
+        Game game = RandomPosition(rng, i);
+        for (int compress = 0; compress < 2; compress++) {
+            WriteSnapshot(game, bytes, compress != 0);
+            Game loaded;
+            if (!ReadSnapshot(loaded, bytes.data(), bytes.size()) || !SameGame(game, loaded)) {
+                fprintf(stderr, "position %d (%dx%d, %s): snapshot did not round-trip\n", i, game.rows, game.cols,
+                        compress ? "rle" : "raw");
+                failures++;
+            }
+            // Every cut-off snapshot must be rejected, not half loaded.
+            if (i % 100 != 0) continue;
+            for (size_t size = 0; size < bytes.size(); size++) {
+                if (ReadSnapshot(loaded, bytes.data(), size)) {
+                    fprintf(stderr, "position %d (%s): snapshot truncated to %zu of %zu bytes was accepted\n", i,
+                            compress ? "rle" : "raw", size, bytes.size());
+                    failures++;
+                    break;
+                }
+                if (!SameGame(game, loaded)) {
+                    fprintf(stderr, "position %d (%s): rejected snapshot changed the game\n", i, compress ? "rle" : "raw");
+                    failures++;
+                    break;
+                }
+            }
+        }
+    }
+
+    // Sizes no Grid can index, patched into a valid 9x9 snapshot.
+    const uint32_t sizes[][2] = { { 1, 0x80000000u }, { 0x80000000u, 1 }, { 0xFFFFFFFFu, 0xFFFFFFFFu }, { 50000, 50000 },
+                                  { 30000, 60000 }, { 0, 9 } };
+    Game small(9, 9, 10, 1);
+    small.HandleClick(4, 4, true);
+    for (int compress = 0; compress < 2; compress++) {
+        for (const uint32_t* rc : sizes) {
+            WriteSnapshot(small, bytes, compress != 0);
+            for (int k = 0; k < 4; k++) {
+                bytes[6 + k] = (uint8_t)(rc[0] >> (8 * k));
+                bytes[10 + k] = (uint8_t)(rc[1] >> (8 * k));
+            }
+            Game loaded = small;
+            bool accepted;
+            try {
+                accepted = ReadSnapshot(loaded, bytes.data(), bytes.size());
+            } catch (const std::exception& e) {
+                fprintf(stderr, "%ux%u (%s): threw %s\n", rc[0], rc[1], compress ? "rle" : "raw", e.what());
+                failures++;
+                continue;
+            }
+            if (accepted || !SameGame(small, loaded)) {
+                fprintf(stderr, "%ux%u (%s): impossible size was %s\n", rc[0], rc[1], compress ? "rle" : "raw",
+                        accepted ? "accepted" : "rejected but changed the game");
+                failures++;
+            }
+        }
+    }
+
+    // A mine layer or a revealed count that disagrees with the rest is only
+    // caught once decoding has started; the game must still come through
+    // unchanged. In a raw snapshot the revealed count sits at byte 30 and
+    // the mine layer follows the 47-byte header and an 8-byte length.
+    for (size_t at : { (size_t)30, (size_t)47 + 8 }) {
+        WriteSnapshot(small, bytes, false);
+        bytes[at] ^= 0x10;
+        Game loaded = small;
+        if (ReadSnapshot(loaded, bytes.data(), bytes.size()) || !SameGame(small, loaded)) {
+            fprintf(stderr, "byte %zu flipped: corrupt snapshot was accepted or changed the game\n", at);
+            failures++;
+        }
+    }
+
+    if (failures) return 1;
+    printf("%d positions round-tripped\n", POSITIONS);
+    return 0;
+}
@@ -0,0 +1,214 @@
+#include "endless.h"
+#include "rng.h"
+#include <cstdlib>
+
+static const uint8_t REVEALED = (uint8_t)((int)CellState::Revealed << Grid::STATE_SHIFT);
+
+EndlessBoard::EndlessBoard(uint64_t s, float d) {
+    Reset(s, d);
+}
+
+void EndlessBoard::Reset(uint64_t s, float d) {
+    seed = s;
+    density = d < 0.12f ? 0.12f : (d > 0.9f ? 0.9f : d);
+    threshold = (uint32_t)(density * 4294967295.0);
+    chunks.clear();
+    resolved.clear();
+    revealedCnt = 0;
+    flagsPlaced = 0;
+    clock.Reset();
+    gameOver = false;
+    explodedRow = explodedCol = 0;
+}
+
+void EndlessBoard::GenerateMines(long long cy, long long cx, Chunk& chunk) const {
+    uint64_t state = seed ^ (Key(cy, cx) * 0x9E3779B97F4A7C15ULL);
+    Xoshiro256 rng(SplitMix64(state));
+    int safe = 0;
+    for (int i = 0; i < CHUNK * CHUNK; i++) {
+        long long row = (cy << CHUNK_BITS) + (i >> CHUNK_BITS);
+        long long col = (cx << CHUNK_BITS) + (i & (CHUNK - 1));
+        bool mine = (uint32_t)(rng.Next() >> 32) < threshold;
+        if (row >= -1 && row <= 1 && col >= -1 && col <= 1) mine = false;
+        chunk.cells[i] = mine ? Grid::MINE_BIT : 0;
+        safe += !mine;
+    }
+    chunk.hiddenSafe = safe;
+}
+
+EndlessBoard::Chunk& EndlessBoard::Get(long long cy, long long cx) {
+    uint64_t key = Key(cy, cx);
+    auto it = chunks.find(key);
+    if (it != chunks.end()) return *it->second;
+
+    std::unique_ptr<Chunk> chunk(new Chunk());
+    GenerateMines(cy, cx, *chunk);
+    auto r = resolved.find(key);
+    if (r != resolved.end()) {
+        // Every safe cell was revealed; adjacent counts are recomputed lazily.
+        for (int i = 0; i < CHUNK * CHUNK; i++) {
+            if (!(chunk->cells[i] & Grid::MINE_BIT)) chunk->cells[i] |= REVEALED;
+        }
+        for (uint16_t m : r->second) chunk->cells[m & 0xFFF] |= (uint8_t)((m >> 12) << Grid::STATE_SHIFT);
+        chunk->hiddenSafe = 0;
+        chunk->touched = true;
+        resolved.erase(r);
+    }
+    Chunk& ref = *chunk;
+    chunks.emplace(key, std::move(chunk));
+    return ref;
+}
+
+bool EndlessBoard::IsMine(long long row, long long col) {
+    return (Cell(row, col) & Grid::MINE_BIT) != 0;
+}
+
+int EndlessBoard::Adjacent(long long row, long long col) {
+    uint8_t& cell = Cell(row, col);
+    if (!(cell & ADJ_KNOWN)) {
+        int cnt = 0;
+        for (int dr = -1; dr <= 1; dr++) {
+            for (int dc = -1; dc <= 1; dc++) {
+                if (dr != 0 || dc != 0) cnt += IsMine(row + dr, col + dc);
+            }
+        }
+        cell = (uint8_t)((cell & ~Grid::ADJ_MASK) | (cnt << Grid::ADJ_SHIFT) | ADJ_KNOWN);
+    }
+    return (cell & Grid::ADJ_MASK) >> Grid::ADJ_SHIFT;
+}
+
+CellState EndlessBoard::State(long long row, long long col) {
+    return (CellState)((Cell(row, col) & Grid::STATE_MASK) >> Grid::STATE_SHIFT);
+}
+
+uint8_t EndlessBoard::Peek(long long row, long long col) {
+    uint64_t key = Key(row >> CHUNK_BITS, col >> CHUNK_BITS);
+    if (chunks.find(key) == chunks.end() && resolved.find(key) == resolved.end()) return 0;
+    uint8_t& cell = Cell(row, col);
+    if ((cell & Grid::STATE_MASK) == REVEALED && !(cell & Grid::MINE_BIT)) Adjacent(row, col);
+    return cell;
+}
+
+void EndlessBoard::RevealSafe(Chunk& chunk, uint8_t& cell) {
+    cell |= REVEALED;
+    chunk.hiddenSafe--;
+    chunk.touched = true;
+    revealedCnt++;
+}
+
+void EndlessBoard::Reveal(long long row, long long col) {
+    if (gameOver) return;
+    Chunk& chunk = ChunkFor(row, col);
+    uint8_t& cell = Cell(row, col);
+    if (cell & Grid::STATE_MASK) return;
+    if (cell & Grid::MINE_BIT) {
+        cell |= REVEALED;
+        chunk.touched = true;
+        gameOver = true;
+        explodedRow = row;
+        explodedCol = col;
+        return;
+    }
+    RevealSafe(chunk, cell);
+    if (Adjacent(row, col) != 0) return;
+
+    // Same worklist flood as Grid::FloodReveal, across chunk borders.
+    work.clear();
+    work.push_back(row);
+    work.push_back(col);
+    while (!work.empty()) {
+        long long c = work.back(); work.pop_back();
+        long long r = work.back(); work.pop_back();
+        for (int dr = -1; dr <= 1; dr++) {
+            for (int dc = -1; dc <= 1; dc++) {
+                if (dr == 0 && dc == 0) continue;
+                long long nr = r + dr, nc = c + dc;
+                Chunk& nchunk = ChunkFor(nr, nc);
+                uint8_t& n = nchunk.cells[((nr & (CHUNK - 1)) << CHUNK_BITS) | (nc & (CHUNK - 1))];
+                if (n & Grid::STATE_MASK) continue;
+                RevealSafe(nchunk, n);
+                if (Adjacent(nr, nc) == 0) {
+                    work.push_back(nr);
+                    work.push_back(nc);
+                }
+            }
+        }
+    }
+}
+
+void EndlessBoard::HandleClick(long long row, long long col, bool leftClick) {
+    if (gameOver) return;
+    if (leftClick) {
+        if (State(row, col) == CellState::Revealed) Chord(row, col);
+        else Reveal(row, col);
+        return;
+    }
+    Chunk& chunk = ChunkFor(row, col);
+    uint8_t& cell = Cell(row, col);
+    CellState state = (CellState)((cell & Grid::STATE_MASK) >> Grid::STATE_SHIFT);
+    CellState next = state;
+    switch (state) {
+    case CellState::Hidden: next = CellState::Flagged; flagsPlaced++; break;
+    case CellState::Flagged: next = CellState::Questioned; flagsPlaced--; break;
+    case CellState::Questioned: next = CellState::Hidden; break;
+    case CellState::Revealed: return;
+    }
+    cell = (uint8_t)((cell & ~Grid::STATE_MASK) | ((int)next << Grid::STATE_SHIFT));
+    chunk.touched = true;
+}
+
+void EndlessBoard::HandleClick(long long row, long long col, bool leftClick, GameClock::Clock::time_point at) {
+    HandleClick(row, col, leftClick);
+    if (gameOver) clock.Stop(at);
+    else if (revealedCnt > 0) clock.Start(at);
+}
+
+// Safe cells go first, so a wrong flag still opens them before the mine
+// it hid ends the game.
+void EndlessBoard::Chord(long long row, long long col) {
+    if (gameOver || State(row, col) != CellState::Revealed) return;
+    int adjacent = Adjacent(row, col);
+    if (adjacent == 0) return;
+    int flags = 0;
+    for (int dr = -1; dr <= 1; dr++)
+        for (int dc = -1; dc <= 1; dc++)
+            if ((dr || dc) && State(row + dr, col + dc) == CellState::Flagged) flags++;
+    if (flags != adjacent) return;
+    for (int mines = 0; mines < 2; mines++)
+        for (int dr = -1; dr <= 1; dr++)
+            for (int dc = -1; dc <= 1; dc++)
+                if ((dr || dc) && IsMine(row + dr, col + dc) == (mines == 1)) Reveal(row + dr, col + dc);
+}
+
+void EndlessBoard::Evict(long long row, long long col, int keepChunks) {
+    long long cy0 = row >> CHUNK_BITS;
+    long long cx0 = col >> CHUNK_BITS;
+    for (auto it = chunks.begin(); it != chunks.end();) {
+        long long cy = (int32_t)(uint32_t)(it->first >> 32);
+        long long cx = (int32_t)(uint32_t)it->first;
+        if (llabs(cy - cy0) <= keepChunks && llabs(cx - cx0) <= keepChunks) { ++it; continue; }
+
+        const Chunk& chunk = *it->second;
+        if (!chunk.touched) {
+            it = chunks.erase(it);
+            continue;
+        }
+        if (chunk.hiddenSafe == 0) {
+            std::vector<uint16_t>& marks = resolved[it->first];
+            for (int i = 0; i < CHUNK * CHUNK; i++) {
+                uint8_t state = chunk.cells[i] & Grid::STATE_MASK;
+                if ((chunk.cells[i] & Grid::MINE_BIT) && state) marks.push_back((uint16_t)(i | ((state >> Grid::STATE_SHIFT) << 12)));
+            }
+            marks.shrink_to_fit();
+            it = chunks.erase(it);
+            continue;
+        }
+        ++it;
+    }
+}
+
+size_t EndlessBoard::MemoryBytes() const {
+    size_t bytes = chunks.size() * (sizeof(Chunk) + sizeof(void*) * 4);
+    for (const auto& r : resolved) bytes += sizeof(void*) * 6 + r.second.capacity() * sizeof(uint16_t);
+    return bytes;
+}
@@ -0,0 +1,84 @@
+#pragma once
+#include "gameclock.h"
+#include "grid.h"
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+// Unbounded board for endless mode, stored as 64x64 chunks in a hash map.
+// A chunk's mines are a pure function of the seed and its coordinates, so
+// chunks can be created in any order and dropped when they hold no player
+// state. Cells use the same byte layout as Grid, plus ADJ_KNOWN once the
+// adjacent count has been computed (which may load neighboring chunks).
+// The 3x3 block around (0, 0) is always safe and is where a game starts.
+class EndlessBoard {
+public:
+    static const int CHUNK_BITS = 6;
+    static const int CHUNK = 1 << CHUNK_BITS;
+    static const uint8_t ADJ_KNOWN = 0x80;
+
+    long long revealedCnt = 0;
+    int flagsPlaced = 0;
+    // Runs from the first reveal until a mine is hit.
+    GameClock clock;
+    bool gameOver = false;
+    long long explodedRow = 0;
+    long long explodedCol = 0;
+
+    // Density is clamped to [0.12, 0.9]: below about 0.1 the zero cells
+    // percolate and a single opening would never end.
+    EndlessBoard(uint64_t seed = 0, float density = 0.16f);
+    void Reset(uint64_t seed, float density);
+
+    uint64_t GetSeed() const { return seed; }
+    float GetDensity() const { return density; }
+
+    bool IsMine(long long row, long long col);
+    int Adjacent(long long row, long long col);
+    CellState State(long long row, long long col);
+    // Cell byte for drawing. Does not load chunks just to draw hidden cells:
+    // cells of chunks that were never loaded read as hidden and empty.
+    uint8_t Peek(long long row, long long col);
+
+    // A left click on a revealed number chords, as in Game::HandleClick.
+    void HandleClick(long long row, long long col, bool leftClick);
+    // The same, starting and stopping the clock at the click's time.
+    void HandleClick(long long row, long long col, bool leftClick, GameClock::Clock::time_point at);
+    void Reveal(long long row, long long col);
+    // Reveals the hidden neighbors of a revealed number once as many of its
+    // neighbors are flagged.
+    void Chord(long long row, long long col);
+
+    // Drops chunks farther than keepChunks (in chunks) from the given cell.
+    // Untouched chunks are discarded; fully resolved ones (every safe cell
+    // revealed) keep only the marks on their mines and are rebuilt from the
+    // seed on demand. Chunks still in play are kept.
+    void Evict(long long row, long long col, int keepChunks);
+
+    size_t LoadedChunks() const { return chunks.size(); }
+    size_t ResolvedChunks() const { return resolved.size(); }
+    size_t MemoryBytes() const;
+
+private:
+    struct Chunk {
+        uint8_t cells[CHUNK * CHUNK];
+        int hiddenSafe = 0;
+        bool touched = false;
+    };
+
+    static uint64_t Key(long long cy, long long cx) { return ((uint64_t)(uint32_t)cy << 32) | (uint32_t)cx; }
+    Chunk& Get(long long cy, long long cx);
+    Chunk& ChunkFor(long long row, long long col) { return Get(row >> CHUNK_BITS, col >> CHUNK_BITS); }
+    uint8_t& Cell(long long row, long long col) { return ChunkFor(row, col).cells[((row & (CHUNK - 1)) << CHUNK_BITS) | (col & (CHUNK - 1))]; }
+    void GenerateMines(long long cy, long long cx, Chunk& chunk) const;
+    void RevealSafe(Chunk& chunk, uint8_t& cell);
+
+    uint64_t seed = 0;
+    float density = 0.16f;
+    uint32_t threshold = 0;
+    std::unordered_map<uint64_t, std::unique_ptr<Chunk>> chunks;
+    // Resolved chunks: (cell index | state << 12) for each marked mine.
+    std::unordered_map<uint64_t, std::vector<uint16_t>> resolved;
+    std::vector<long long> work;
+};
@@ -1,274 +1,455 @@
 #include "game.h"
-#include <cstdlib>
-#include <ctime>
-#include <cmath>
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <thread>
+
+namespace {
+
+// Runs task(0) .. task(tasks - 1) on up to `threads` threads, the calling
+// thread included; threads <= 0 uses one per core.
+template <class Task>
+void ParallelFor(int tasks, int threads, Task&& task) {
+    if (threads <= 0) threads = (int)std::max(1u, std::thread::hardware_concurrency());
+    threads = std::min(threads, tasks);
+    std::atomic<int> next(0);
+    auto work = [&]() {
+        for (int i; (i = next.fetch_add(1)) < tasks;) task(i);
+    };
+    std::vector<std::thread> workers;
+    for (int t = 1; t < threads; t++) workers.emplace_back(work);
+    work();
+    for (std::thread& w : workers) w.join();
+}
+
+}
 
 Game::Game(int r, int c, int m) {
     Init(r, c, m);
 }
 
+Game::Game(int r, int c, int m, uint64_t s) {
+    Init(r, c, m, s);
+}
+
 void Game::Init(int r, int c, int m) {
+    Init(r, c, m, RandomSeed());
+}
+
+// Later boards started with NewGame() draw their seeds from a sequence
+// derived from this one, so a whole session is reproducible too.
+void Game::Init(int r, int c, int m, uint64_t s) {
     rows = r;
     cols = c;
     mineCount = m;
 
-    grid.assign(rows, std::vector<Cell>(cols));
-    NewGame();
+    grid.Resize(rows, cols);
+    mineBits.Resize(rows, cols);
+    seeder.Seed(s ^ 0xA5A5A5A5A5A5A5A5ULL);
+    NewGame(s);
 }
 
 void Game::NewGame() {
-    for (int i = 0; i < rows; i++) {
-        for (int j = 0; j < cols; j++) {
-            grid[i][j] = Cell{};
-        }
+    NewGame(seeder.Next());
+}
+
+void Game::NewGame(uint64_t s) {
+    seed = s;
+    if (Striped()) {
+        int stripes = (rows + STRIPE_ROWS - 1) / STRIPE_ROWS;
+        ParallelFor(stripes, threads, [this](int i) { grid.Clear(i * STRIPE_ROWS, std::min(rows, (i + 1) * STRIPE_ROWS)); });
     }
+    else grid.Clear();
     flagsLeft = mineCount;
     revealedCnt = 0;
-    timer = 0.0f;
+    flaggedMines = 0;
+    wrongFlags = 0;
+    clock.Reset();
+    firstClickAt = winningClickAt = GameClock::Clock::time_point();
     gameOver = false;
     victory = false;
     firstClick = true;
     minesPlaced = false;
     explodedRow = explodedCol = -1;
+    revealLog.clear();
+    history.clear();
+    historyPos = 0;
+    log.Begin(rows, cols, mineCount, seed);
+    dirtyCells.clear();
+    allDirty = true;
 }
 
-void Game::SetTextures(Texture2D bomb, Texture2D bombExploded, Texture2D question, Texture2D flag) {
-    bombTexture = bomb;
-    bombExplodedTexture = bombExploded;
-    questionTexture = question;
-    flagTexture = flag;
+void Game::PlaceMines(int row, int col) {
+    if (Striped()) {
+        PlaceMinesStriped(row, col);
+        return;
+    }
+    rng.Seed(seed);
+    mineBits.Clear();
+    mineBits.PlaceRandom(mineCount, row, col, [this](long long n) { return (long long)rng.Below((uint64_t)n); });
+    grid.LoadMines(mineBits);
+    CalculateNumbers();
+    CountFlags();
+    minesPlaced = true;
 }
 
-void Game::SetFaceTextures(Texture2D f1, Texture2D f2, Texture2D f3, Texture2D f4) {
-    faceTextures[0] = f1; faceTextures[1] = f2; faceTextures[2] = f3; faceTextures[3] = f4;
-}
+// Every stripe makes each of its cells a mine with the same probability p,
+// close to mines / allowed cells, from its own xoshiro stream (one Jump
+// apart). Such a layout, given its total, is uniform over all layouts with
+// that total whatever p is, and adding uniformly chosen safe cells or
+// removing uniformly chosen mines keeps it uniform, so a short serial pass
+// that corrects the total to exactly mineCount gives the same distribution
+// as PlaceRandom. p has 16 binary digits: a word of 64 cells is built by
+// going through them from the lowest set one, OR-ing in a random word for a
+// 1 and AND-ing for a 0, which leaves every bit set with probability p.
+void Game::PlaceMinesStriped(int row, int col) {
+    int r0 = std::max(row - 1, 0), r1 = std::min(row + 1, rows - 1);
+    int c0 = std::max(col - 1, 0), c1 = std::min(col + 1, cols - 1);
+    auto inBlock = [&](int r, int c) { return r >= r0 && r <= r1 && c >= c0 && c <= c1; };
+    long long allowed = (long long)rows * cols - (long long)(r1 - r0 + 1) * (c1 - c0 + 1);
+    long long target = std::min((long long)mineCount, allowed);
+    const int DIGITS = 16;
+    uint32_t p = allowed > 0 ? (uint32_t)((target << DIGITS) / allowed) : 0;
+    int lowest = p ? LowestBit(p) : DIGITS;
 
-void Game::PlaceMines(int row, int col) {
-    int placed = 0;
-    while (placed < mineCount) {
-        int r = rand() % rows;
-        int c = rand() % cols;
-        if (abs(r - row) <= 1 && abs(c - col) <= 1) continue; 
-        if (!grid[r][c].isMine) {
-            grid[r][c].isMine = true;
-            placed++;
+    int stripes = (rows + STRIPE_ROWS - 1) / STRIPE_ROWS;
+    std::vector<Xoshiro256> streams(stripes + 1);
+    rng.Seed(seed);
+    for (int i = 0; i <= stripes; i++) {
+        streams[i] = rng;
+        rng.Jump();
+    }
+    std::vector<long long> placed(stripes);
+
+    ParallelFor(stripes, threads, [&](int i) {
+        int begin = i * STRIPE_ROWS, end = std::min(rows, (i + 1) * STRIPE_ROWS);
+        Xoshiro256& stream = streams[i];
+        int words = mineBits.WordsPerRow();
+        uint64_t lastMask = (cols & 63) ? (1ULL << (cols & 63)) - 1 : ~0ULL;
+        long long count = 0;
+        for (int r = begin; r < end; r++) {
+            uint64_t* w = mineBits.RowWords(r);
+            for (int j = 0; j < words; j++) {
+                uint64_t bits = p >> DIGITS ? ~0ULL : 0;
+                for (int d = lowest; d < DIGITS; d++) {
+                    if ((p >> d) & 1) bits |= stream.Next();
+                    else bits &= stream.Next();
+                }
+                w[j] = bits;
+            }
+            w[words - 1] &= lastMask;
+            if (r >= r0 && r <= r1)
+                for (int c = c0; c <= c1; c++) mineBits.Reset(r, c);
+            for (int j = 0; j < words; j++) count += PopCount(w[j]);
         }
+        placed[i] = count;
+        grid.LoadMines(mineBits, begin, end);
+    });
+
+    long long total = 0;
+    for (long long n : placed) total += n;
+    Xoshiro256& fix = streams[stripes];
+    long long cellCount = (long long)rows * cols;
+    while (total != target) {
+        long long cell = (long long)fix.Below((uint64_t)cellCount);
+        int r = (int)(cell / cols), c = (int)(cell % cols);
+        if (inBlock(r, c) || mineBits.Test(r, c) == (total < target)) continue;
+        bool add = total < target;
+        if (add) mineBits.Set(r, c);
+        else mineBits.Reset(r, c);
+        grid.SetMine(grid.Index(r, c), add);
+        total += add ? 1 : -1;
     }
+
     CalculateNumbers();
+    CountFlags();
     minesPlaced = true;
 }
 
-void Game::CalculateNumbers() {
-    int dx[8] = { -1, -1, -1, 0, 0, 1, 1, 1 };
-    int dy[8] = { -1, 0, 1, -1, 1, -1, 0, 1 };
-    for (int i = 0; i < rows; i++) {
-        for (int j = 0; j < cols; j++) {
-            if (!grid[i][j].isMine) {
-                int cnt = 0;
-                for (int d = 0; d < 8; d++) {
-                    int nx = i + dx[d];
-                    int ny = j + dy[d];
-                    if (nx >= 0 && nx < rows && ny >= 0 && ny < cols) {
-                        if (grid[nx][ny].isMine) cnt++;
-                    }
-                }
-                grid[i][j].adjacent = cnt;
+void Game::SetMines(const Bitboard& mines) {
+    mineBits = mines;
+    log.SetLayout(mines);
+    grid.LoadMines(mineBits);
+    CalculateNumbers();
+    CountFlags();
+    minesPlaced = true;
+}
+
+// Flags may already be on the board from before the first click, when no
+// cell was a mine yet, so the counters are rebuilt once after placement.
+void Game::CountFlags() {
+    auto count = [this](int begin, int end, int& mines, int& wrong) {
+        for (int i = begin; i < end; i++) {
+            int idx = grid.Index(i, 0);
+            for (int j = 0; j < cols; j++, idx++) {
+                if (grid.State(idx) != CellState::Flagged) continue;
+                if (grid.IsMine(idx)) mines++;
+                else wrong++;
             }
         }
+    };
+    flaggedMines = 0;
+    wrongFlags = 0;
+    if (!Striped()) {
+        count(0, rows, flaggedMines, wrongFlags);
+        return;
+    }
+    int stripes = (rows + STRIPE_ROWS - 1) / STRIPE_ROWS;
+    std::vector<int> mines(stripes), wrong(stripes);
+    ParallelFor(stripes, threads, [&](int s) { count(s * STRIPE_ROWS, std::min(rows, (s + 1) * STRIPE_ROWS), mines[s], wrong[s]); });
+    for (int s = 0; s < stripes; s++) {
+        flaggedMines += mines[s];
+        wrongFlags += wrong[s];
+    }
+}
+
+// A stripe reads the mine bits of the rows bordering it while its
+// neighbours rewrite their cells, so even stripes go first, then odd ones.
+void Game::CalculateNumbers() {
+    if (!Striped()) {
+        grid.ComputeAdjacency();
+        return;
+    }
+    int stripes = (rows + STRIPE_ROWS - 1) / STRIPE_ROWS;
+    for (int parity = 0; parity < 2; parity++) {
+        ParallelFor((stripes + 1 - parity) / 2, threads, [&](int i) {
+            int s = 2 * i + parity;
+            grid.ComputeAdjacency(s * STRIPE_ROWS, std::min(rows, (s + 1) * STRIPE_ROWS));
+        });
     }
 }
 
 void Game::Reveal(int row, int col) {
+    ScopedTimer timer(profiler, "Reveal");
     if (row < 0 || row >= rows || col < 0 || col >= cols) return;
-    if (grid[row][col].state != CellState::Hidden) return;
-    if (grid[row][col].isMine) {
-        grid[row][col].state = CellState::Revealed;
+    int idx = grid.Index(row, col);
+    if (grid.State(idx) != CellState::Hidden) return;
+    if (grid.IsMine(idx)) {
+        grid.SetState(idx, CellState::Revealed);
+        allDirty = true;
         gameOver = true;
         explodedRow = row;
         explodedCol = col;
         return;
     }
-    grid[row][col].state = CellState::Revealed;
+    grid.SetState(idx, CellState::Revealed);
+    MarkDirty(idx);
+    revealLog.push_back(idx);
     revealedCnt++;
-    if (grid[row][col].adjacent == 0) FloodReveal(row, col);
+    if (grid.Adjacent(idx) == 0) FloodReveal(row, col);
 }
 
 void Game::FloodReveal(int row, int col) {
-    int dx[8] = { -1, -1, -1, 0, 0, 1, 1, 1 };
-    int dy[8] = { -1, 0, 1, -1, 1, -1, 0, 1 };
-    for (int d = 0; d < 8; d++) {
-        int nx = row + dx[d];
-        int ny = col + dy[d];
-        if (nx >= 0 && nx < rows && ny >= 0 && ny < cols) {
-            if (grid[nx][ny].state == CellState::Hidden) {
-                Reveal(nx, ny);
-            }
-        }
+    size_t start = revealLog.size();
+    revealedCnt += grid.FloodReveal(grid.Index(row, col), revealStack, &revealLog);
+    MarkOpened(start);
+}
+
+void Game::MarkOpened(size_t start) {
+    if (trackDirty) dirtyCells.insert(dirtyCells.end(), revealLog.begin() + start, revealLog.end());
+    if (dirtyCells.size() > (size_t)rows * cols / 4) {
+        dirtyCells.clear();
+        allDirty = true;
     }
 }
 
 bool Game::CheckVictory() {
+    ScopedTimer timer(profiler, "CheckVictory");
+    if (!minesPlaced) return false;
+    bool won = revealedCnt == rows * cols - mineCount || (flaggedMines == mineCount && wrongFlags == 0);
+    assert(won == CheckVictoryFullScan());
+    return won;
+}
+
+bool Game::CheckVictoryFullScan() {
     if (!minesPlaced) return false;
     if (revealedCnt == rows * cols - mineCount) return true;
     for (int i = 0; i < rows; i++) {
-        for (int j = 0; j < cols; j++) {
-            if (grid[i][j].isMine && grid[i][j].state != CellState::Flagged) return false;
+        int idx = grid.Index(i, 0);
+        for (int j = 0; j < cols; j++, idx++) {
+            if (grid.IsMine(idx) && grid.State(idx) != CellState::Flagged) return false;
         }
     }
     return true;
 }
 
-Color GetNumberColor(int n) {
-    switch (n) {
-    case 1: return BLUE;
-    case 2: return GREEN;
-    case 3: return RED;
-    case 4: return DARKBLUE;
-    case 5: return MAROON;
-    case 6: return SKYBLUE;
-    case 7: return BLACK;
-    case 8: return GRAY;
-    default: return BLACK;
-    }
+void Game::HandleClick(int row, int col, bool leftClick) {
+    ScopedTimer timer(profiler, "HandleClick");
+    if (Apply(row, col, leftClick)) log.Append(row * cols + col, leftClick ? MoveAction::Reveal : MoveAction::Mark);
 }
 
-static void DrawTextureInCell(const Texture2D& tex, int px, int py) {
-    if (tex.id == 0) return;
-    float texW = (float)tex.width;
-    float texH = (float)tex.height;
-    float pad = 2.0f;
-    float dstW = (float)CELL_SIZE - pad * 2.0f;
-    float dstH = (float)CELL_SIZE - pad * 2.0f;
-    float scale = fmaxf(dstW / texW, dstH / texH);
-    float srcW = dstW / scale;
-    float srcH = dstH / scale;
-    float srcX = (texW - srcW) * 0.5f;
-    float srcY = (texH - srcH) * 0.5f;
-    Rectangle src = { srcX, srcY, srcW, srcH };
-    Rectangle dest = { (float)(px + pad), (float)(py + pad), dstW, dstH };
-    Vector2 origin = { 0.0f, 0.0f };
-    DrawTexturePro(tex, src, dest, origin, 0.0f, WHITE);
+void Game::HandleClick(int row, int col, bool leftClick, GameClock::Clock::time_point at) {
+    bool wasFirst = firstClick, wasWon = victory;
+    HandleClick(row, col, leftClick);
+    if (wasFirst && !firstClick) firstClickAt = at;
+    if (!wasWon && victory) winningClickAt = at;
+    SyncClock(at);
 }
 
-void Game::HandleClick(Vector2 mouse, bool leftClick, int offsetX, int offsetY) {
-    if (gameOver || victory) return;
-
-    if (mouse.x < offsetX || mouse.y < offsetY) return;
-    if (mouse.x >= offsetX + cols * CELL_SIZE) return;
-    if (mouse.y >= offsetY + rows * CELL_SIZE) return;
+void Game::SyncClock(GameClock::Clock::time_point at) {
+    if (!firstClick && !gameOver && !victory) clock.Start(at);
+    else clock.Stop(at);
+}
 
-    int col = (int)((mouse.x - offsetX) / CELL_SIZE);
-    int row = (int)((mouse.y - offsetY) / CELL_SIZE);
-    if (col < 0 || col >= cols || row < 0 || row >= rows) return;
+// Returns whether the click changed the board.
+bool Game::Apply(int row, int col, bool leftClick) {
+    if (gameOver || victory) return false;
+    if (col < 0 || col >= cols || row < 0 || row >= rows) return false;
 
-    Cell& cell = grid[row][col];
+    int idx = grid.Index(row, col);
+    HistoryEntry entry = { idx, leftClick, grid.State(idx), (int)revealLog.size(), false };
 
     if (leftClick) {
-        if (cell.state != CellState::Hidden) return;
+        if (grid.State(idx) == CellState::Revealed) return Chord(idx, entry);
+        if (grid.State(idx) != CellState::Hidden) return false;
         if (firstClick) {
-            PlaceMines(row, col);
+            if (!minesPlaced) PlaceMines(row, col);
             firstClick = false;
         }
         Reveal(row, col);
-        if (gameOver) return;
+        entry.exploded = gameOver;
+        Record(entry);
+        if (gameOver) return true;
         victory = CheckVictory();
+        return true;
+    }
+
+    CellState next;
+    switch (grid.State(idx)) {
+    case CellState::Hidden:
+        if (flagsLeft == 0) return false;
+        next = CellState::Flagged;
+        break;
+    case CellState::Flagged:
+        next = CellState::Questioned;
+        break;
+    case CellState::Questioned:
+        next = CellState::Hidden;
+        break;
+    default:
+        return false;
+    }
+    SetMark(idx, next);
+    Record(entry);
+    if (CheckVictory()) victory = true;
+    return true;
+}
+
+// A wrong flag makes the chord open a mine: the game is lost on it, after
+// the safe cells of the same chord have been revealed.
+bool Game::Chord(int idx, HistoryEntry entry) {
+    ScopedTimer timer(profiler, "Chord");
+    int adjacent = grid.Adjacent(idx);
+    if (adjacent == 0) return false;
+    const int* neighbors = grid.Neighbors();
+    int seeds[8];
+    int count = 0;
+    int flags = 0;
+    int mine = -1;
+    for (int d = 0; d < 8; d++) {
+        int n = idx + neighbors[d];
+        CellState s = grid.State(n);
+        if (s == CellState::Flagged) flags++;
+        else if (s != CellState::Hidden) continue;
+        else if (grid.IsMine(n)) mine = n;
+        else seeds[count++] = n;
     }
+    if (flags != adjacent || (count == 0 && mine < 0)) return false;
+
+    size_t start = revealLog.size();
+    revealedCnt += grid.RevealBatch(seeds, count, revealStack, &revealLog);
+    MarkOpened(start);
+    if (mine >= 0) {
+        grid.SetState(mine, CellState::Revealed);
+        allDirty = true;
+        gameOver = true;
+        explodedRow = grid.RowOf(mine);
+        explodedCol = grid.ColOf(mine);
+    }
+    entry.exploded = gameOver;
+    Record(entry);
+    if (!gameOver) victory = CheckVictory();
+    return true;
+}
+
+// Keeps flagsLeft and the victory counters in step with a flag change.
+void Game::SetMark(int idx, CellState s) {
+    CellState old = grid.State(idx);
+    if (old == CellState::Flagged) {
+        flagsLeft++;
+        if (grid.IsMine(idx)) flaggedMines--;
+        else wrongFlags--;
+    }
+    if (s == CellState::Flagged) {
+        flagsLeft--;
+        if (grid.IsMine(idx)) flaggedMines++;
+        else wrongFlags++;
+    }
+    grid.SetState(idx, s);
+    MarkDirty(idx);
+}
+
+void Game::Record(const HistoryEntry& entry) {
+    bool same = historyPos < history.size() && history[historyPos].idx == entry.idx && history[historyPos].leftClick == entry.leftClick;
+    if (same) history[historyPos] = entry;
     else {
-        switch (cell.state) {
-        case CellState::Hidden:
-            if (flagsLeft > 0) { cell.state = CellState::Flagged; flagsLeft--; }
-            break;
-        case CellState::Flagged:
-            cell.state = CellState::Questioned;
-            flagsLeft++;
-            break;
-        case CellState::Questioned:
-            cell.state = CellState::Hidden;
-            break;
-        case CellState::Revealed:
-            break;
+        history.resize(historyPos);
+        history.push_back(entry);
+    }
+    historyPos++;
+}
+
+bool Game::Undo() {
+    if (historyPos == 0) return false;
+    const HistoryEntry& e = history[--historyPos];
+    undoCount++;
+    if (e.leftClick) {
+        for (size_t i = (size_t)e.revealStart; i < revealLog.size(); i++) {
+            grid.SetState(revealLog[i], CellState::Hidden);
+            MarkDirty(revealLog[i]);
+        }
+        revealedCnt -= (int)(revealLog.size() - e.revealStart);
+        revealLog.resize(e.revealStart);
+        if (e.exploded) {
+            // A losing chord exploded a neighbor of the cell it was made on.
+            grid.SetState(grid.Index(explodedRow, explodedCol), CellState::Hidden);
+            gameOver = false;
+            explodedRow = explodedCol = -1;
+            allDirty = true;
+        }
+        if (dirtyCells.size() > (size_t)rows * cols / 4) {
+            dirtyCells.clear();
+            allDirty = true;
         }
-        if (CheckVictory()) victory = true;
     }
+    else SetMark(e.idx, e.before);
+    victory = CheckVictory();
+    log.Append(0, MoveAction::Undo);
+    return true;
 }
 
-void Game::DrawGrid(int offsetX, int offsetY) {
-    Color unopenedBg = Color{ 160,160,160,255 };
-    Color openedBg = Color{ 205,205,205,255 };
-    Color borderColor = DARKGRAY;
-    for (int row = 0; row < rows; row++) {
-        for (int col = 0; col < cols; col++) {
-            int px = offsetX + col * CELL_SIZE;
-            int py = offsetY + row * CELL_SIZE;
-            Cell& c = grid[row][col];
-            if (c.state == CellState::Revealed) {
-                DrawRectangle(px, py, CELL_SIZE, CELL_SIZE, openedBg);
-            }
-            else {
-                DrawRectangle(px, py, CELL_SIZE, CELL_SIZE, unopenedBg);
-                DrawRectangle(px + 1, py + 1, CELL_SIZE - 2, 2, Color{ 230,230,230,255 });
-                DrawRectangle(px + 1, py + 1, 2, CELL_SIZE - 2, Color{ 230,230,230,255 });
-            }
-            DrawRectangleLines(px, py, CELL_SIZE, CELL_SIZE, borderColor);
-
-            if (c.state == CellState::Revealed) {
-                if (c.isMine) {
-                    if ((col == explodedCol && row == explodedRow) && bombExplodedTexture.id != 0) {
-                        DrawTextureInCell(bombExplodedTexture, px, py);
-                    }
-                    else if (bombTexture.id != 0) {
-                        DrawTextureInCell(bombTexture, px, py);
-                    }
-                    else {
-                        DrawRectangle(px + 6, py + 6, CELL_SIZE - 12, CELL_SIZE - 12, BLACK);
-                        DrawText("X", px + (CELL_SIZE - MeasureText("X", 26)) / 2, py + (CELL_SIZE - 26) / 2, 26, RED);
-                    }
-                }
-                else if (c.adjacent > 0) {
-                    char buf[4];
-                    buf[0] = '0' + c.adjacent; buf[1] = '\0';
-                    int fontSize = 30;
-                    int tw = MeasureText(buf, fontSize);
-                    DrawText(buf, px + (CELL_SIZE - tw) / 2, py + (CELL_SIZE - fontSize) / 2, fontSize, GetNumberColor(c.adjacent));
-                }
-            }
-            else {
-                if (c.state == CellState::Flagged) {
-                    if (flagTexture.id != 0) DrawTextureInCell(flagTexture, px, py);
-                    else {
-                        const char* ftxt = "F";
-                        int fontSize = 30;
-                        int tw = MeasureText(ftxt, fontSize);
-                        DrawText(ftxt, px + (CELL_SIZE - tw) / 2, py + (CELL_SIZE - fontSize) / 2, fontSize, RED);
-                    }
-                }
-                else if (c.state == CellState::Questioned) {
-                    if (questionTexture.id != 0) DrawTextureInCell(questionTexture, px, py);
-                    else {
-                        const char* qtxt = "?";
-                        int fontSize = 34;
-                        int tw = MeasureText(qtxt, fontSize);
-                        DrawText(qtxt, px + (CELL_SIZE - tw) / 2, py + (CELL_SIZE - fontSize) / 2, fontSize, BLACK);
-                    }
-                }
-            }
+bool Game::Redo() {
+    if (historyPos == history.size()) return false;
+    const HistoryEntry& e = history[historyPos];
+    if (!Apply(grid.RowOf(e.idx), grid.ColOf(e.idx), e.leftClick)) return false;
+    log.Append(0, MoveAction::Redo);
+    return true;
+}
 
-            if (gameOver && c.isMine && c.state != CellState::Revealed) {
-                if (col == explodedCol && row == explodedRow) {
-                    if (bombExplodedTexture.id != 0) DrawTextureInCell(bombExplodedTexture, px, py);
-                    else {
-                        DrawRectangle(px + 6, py + 6, CELL_SIZE - 12, CELL_SIZE - 12, BLACK);
-                        DrawText("X", px + (CELL_SIZE - MeasureText("X", 26)) / 2, py + (CELL_SIZE - 26) / 2, 26, RED);
-                    }
-                }
-                else {
-                    if (bombTexture.id != 0) DrawTextureInCell(bombTexture, px, py);
-                    else {
-                        DrawRectangle(px + 6, py + 6, CELL_SIZE - 12, CELL_SIZE - 12, BLACK);
-                        DrawText("X", px + (CELL_SIZE - MeasureText("X", 26)) / 2, py + (CELL_SIZE - 26) / 2, 26, RED);
-                    }
-                }
-            }
+void Game::Replay(const MoveLog& record) {
+    Init(record.rows, record.cols, record.mines, record.seed);
+    LoggedMove move;
+    size_t pos = 0;
+    while (record.Next(pos, move)) {
+        switch (move.action) {
+        case MoveAction::Reveal:
+            // A given layout went in just before the first reveal.
+            if (record.hasLayout && !minesPlaced) SetMines(record.layout);
+            HandleClick(move.cell / cols, move.cell % cols, true);
+            break;
+        case MoveAction::Mark: HandleClick(move.cell / cols, move.cell % cols, false); break;
+        case MoveAction::Undo: Undo(); break;
+        case MoveAction::Redo: Redo(); break;
         }
     }
 }
@@ -1,32 +1,39 @@
 #pragma once
-#include <raylib.h>
+#include "bitboard.h"
+#include "gameclock.h"
+#include "grid.h"
+#include "movelog.h"
+#include "profiler.h"
+#include "rng.h"
 #include <vector>
 
-const int CELL_SIZE = 48; 
-
-enum class CellState {
-    Hidden,
-    Revealed,
-    Flagged,
-    Questioned
-};
-
-struct Cell {
-    bool isMine = false; 
-    int adjacent = 0; 
-    CellState state = CellState::Hidden;
-};
-
 class Game {
 public:
     int rows;
     int cols;
     int mineCount;
 
-    std::vector<std::vector<Cell>> grid;
+    // The board is a function of seed and the first click only.
+    uint64_t seed;
+    Xoshiro256 rng;
+    Xoshiro256 seeder;
+
+    Grid grid;
+    Bitboard mineBits;
+    std::vector<int> revealStack;
+    // Every safe cell revealed this game, in order, so observers such as the
+    // solver can catch up by reading only the entries added since last time.
+    std::vector<int> revealLog;
     int flagsLeft;
     int revealedCnt;
-    float timer;
+    int flaggedMines;
+    int wrongFlags;
+    // Runs from the first click to a win or a loss. firstClickAt and
+    // winningClickAt are the timestamps of those clicks, set only by the
+    // timed HandleClick; both are zero until then.
+    GameClock clock;
+    GameClock::Clock::time_point firstClickAt;
+    GameClock::Clock::time_point winningClickAt;
     bool gameOver;
     bool victory;
     bool firstClick;
@@ -35,28 +42,93 @@ public:
     int explodedRow;
     int explodedCol;
 
-    Texture2D bombTexture = { 0 };
-    Texture2D bombExplodedTexture = { 0 };
-    Texture2D questionTexture = { 0 };
-    Texture2D flagTexture = { 0 };
-    Texture2D faceTextures[4] = { {0},{0},{0},{0} };
+    // Undo history, one entry per move that changed the board. A reveal
+    // keeps where its cells start in revealLog, so undoing it hides exactly
+    // the cells it opened; nothing else about the board is copied.
+    struct HistoryEntry {
+        int idx;
+        bool leftClick;
+        CellState before;
+        int revealStart;
+        bool exploded;
+    };
+    std::vector<HistoryEntry> history;
+    size_t historyPos = 0;
+    // Counts every Undo and never goes back, so observers that follow
+    // revealLog can tell that cells they took in may be hidden again.
+    uint64_t undoCount = 0;
+    // Everything needed to replay this game, undos included.
+    MoveLog log;
+
+    // Cells whose appearance changed since the renderer last drew them.
+    // Only recorded once a renderer sets trackDirty; allDirty stands for
+    // changes too broad to list, such as a new game or a loss.
+    std::vector<int> dirtyCells;
+    bool allDirty = true;
+    bool trackDirty = false;
+
+    // When set and enabled, HandleClick, Reveal and CheckVictory are timed.
+    Profiler* profiler = nullptr;
+
+    // Boards of at least PARALLEL_CELLS cells are cleared, mined and counted
+    // in stripes of STRIPE_ROWS rows on up to `threads` threads (0: one per
+    // core). The layout depends on the stripes, never on the thread count.
+    static const long long PARALLEL_CELLS = 1LL << 22;
+    static const int STRIPE_ROWS = 64;
+    int threads = 0;
 
     Game(int rows = 9, int cols = 9, int mines = 10);
+    Game(int rows, int cols, int mines, uint64_t seed);
     void Init(int rows, int cols, int mines);
+    void Init(int rows, int cols, int mines, uint64_t seed);
     void NewGame();
+    void NewGame(uint64_t seed);
 
-    void DrawGrid(int offsetX, int offsetY);
-    void HandleClick(Vector2 mouse, bool leftClick, int offsetX, int offsetY);
+    // A left click on a revealed number chords: once as many neighbors are
+    // flagged as the number says, its other hidden neighbors are revealed.
+    void HandleClick(int row, int col, bool leftClick);
+    // The same, for a click made at the given time: starts and stops the
+    // clock and records the first and winning clicks. The untimed version
+    // leaves the clock alone, which suits the simulator and the server.
+    void HandleClick(int row, int col, bool leftClick, GameClock::Clock::time_point at);
+    // Starts or stops the clock to match the game, for changes that are not
+    // clicks, such as undo and redo or resuming a saved game.
+    void SyncClock(GameClock::Clock::time_point at);
+    // Steps back or forward through history. Undoing a loss resumes the
+    // game; undoing the first reveal keeps the mine layout. A new move
+    // after an undo drops the redo entries unless it repeats the next one.
+    bool Undo();
+    bool Redo();
+    bool CanUndo() const { return historyPos > 0; }
+    bool CanRedo() const { return historyPos < history.size(); }
+    // Starts the game in the record over and plays all of its moves.
+    void Replay(const MoveLog& record);
     void Reveal(int row, int col);
     void FloodReveal(int row, int col);
     void PlaceMines(int row, int col);
+    void PlaceMinesStriped(int row, int col);
+    // Uses a given layout instead of PlaceMines. Call before the first click,
+    // which still counts as the first (and starts the clock) but places
+    // nothing; the board then no longer follows from the seed.
+    void SetMines(const Bitboard& mines);
     void CalculateNumbers();
     bool CheckVictory();
-
-    void SetTextures(Texture2D bomb, Texture2D bombExploded, Texture2D question, Texture2D flag);
-    void SetFaceTextures(Texture2D f1, Texture2D f2, Texture2D f3, Texture2D f4);
+    bool CheckVictoryFullScan();
+    void CountFlags();
+    bool Apply(int row, int col, bool leftClick);
+    // Reveals the chorded neighbors of idx through one Grid::RevealBatch;
+    // the move is recorded, checked for victory and made dirty once.
+    bool Chord(int idx, HistoryEntry entry);
+    // Dirty tracking for the cells revealLog gained from start on.
+    void MarkOpened(size_t start);
+    void SetMark(int idx, CellState s);
+    void Record(const HistoryEntry& entry);
+    void MarkDirty(int idx) { if (trackDirty) dirtyCells.push_back(idx); }
+    void ClearDirty() { dirtyCells.clear(); allDirty = false; }
+    bool Striped() const { return (long long)rows * cols >= PARALLEL_CELLS; }
 
     int GetRows() const { return rows; }
     int GetCols() const { return cols; }
     int GetMineCount() const { return mineCount; }
+    uint64_t GetSeed() const { return seed; }
 };
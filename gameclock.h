@@ -0,0 +1,36 @@
+#pragma once
+#include <chrono>
+
+// Play time read from std::chrono::steady_clock. It does not depend on the
+// frame rate and does not drift when frames are skipped. Start and Stop take
+// the timestamp of the input that caused them rather than the time of the
+// frame that handled it.
+class GameClock {
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    // Stops the clock with seconds already on it, as for a resumed game.
+    void Reset(double seconds = 0.0) {
+        banked = seconds;
+        running = false;
+    }
+    void Start(Clock::time_point at) {
+        if (running) return;
+        since = at;
+        running = true;
+    }
+    void Stop(Clock::time_point at) {
+        if (!running) return;
+        banked += std::chrono::duration<double>(at - since).count();
+        running = false;
+    }
+    bool Running() const { return running; }
+    double Seconds(Clock::time_point now) const {
+        return running ? banked + std::chrono::duration<double>(now - since).count() : banked;
+    }
+
+private:
+    double banked = 0.0;
+    Clock::time_point since;
+    bool running = false;
+};
@@ -0,0 +1,152 @@
+#include "grid.h"
+#include "bitboard.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define GRID_USE_SSE2
+#endif
+
+Grid::Grid(int r, int c) {
+    Resize(r, c);
+}
+
+void Grid::Resize(int r, int c) {
+    rows = r;
+    cols = c;
+    stride = cols + 2;
+
+    int k = 0;
+    for (int dr = -1; dr <= 1; dr++) {
+        for (int dc = -1; dc <= 1; dc++) {
+            if (dr == 0 && dc == 0) continue;
+            neighbors[k++] = dr * stride + dc;
+        }
+    }
+
+    cells.assign((size_t)(rows + 2) * stride, 0);
+    Clear();
+}
+
+void Grid::Clear(int rowBegin, int rowEnd) {
+    uint8_t* p = cells.data();
+    for (int j = 0; j < stride; j++) {
+        if (rowBegin == 0) p[j] = BORDER_CELL;
+        if (rowEnd == rows) p[(size_t)(rows + 1) * stride + j] = BORDER_CELL;
+    }
+    for (int i = rowBegin + 1; i <= rowEnd; i++) {
+        uint8_t* row = p + (size_t)i * stride;
+        row[0] = BORDER_CELL;
+        for (int j = 1; j <= cols; j++) row[j] = 0;
+        row[cols + 1] = BORDER_CELL;
+    }
+}
+
+void Grid::LoadMines(const Bitboard& mines, int rowBegin, int rowEnd) {
+    for (int i = rowBegin; i < rowEnd; i++) {
+        const uint64_t* words = mines.RowWords(i);
+        uint8_t* row = cells.data() + Index(i, 0);
+        for (int w = 0; w < mines.WordsPerRow(); w++) {
+            uint64_t bits = words[w];
+            while (bits) {
+                row[w * 64 + LowestBit(bits)] |= MINE_BIT;
+                bits &= bits - 1;
+            }
+        }
+    }
+}
+
+// Each neighbor offset selects a shifted view of the mine plane; adding the
+// eight views bytewise gives every cell's count in one pass per row.
+void Grid::ComputeAdjacency(int rowBegin, int rowEnd) {
+    uint8_t* p = cells.data();
+    for (int i = rowBegin; i < rowEnd; i++) {
+        int idx = Index(i, 0);
+        int end = idx + cols;
+#if defined(__AVX2__)
+        const __m256i one = _mm256_set1_epi8(MINE_BIT);
+        const __m256i adjMask = _mm256_set1_epi8((char)ADJ_MASK);
+        for (; idx + 32 <= end; idx += 32) {
+            __m256i sum = _mm256_setzero_si256();
+            for (int d = 0; d < 8; d++) {
+                __m256i v = _mm256_loadu_si256((const __m256i*)(p + idx + neighbors[d]));
+                sum = _mm256_add_epi8(sum, _mm256_and_si256(v, one));
+            }
+            __m256i cur = _mm256_loadu_si256((const __m256i*)(p + idx));
+            __m256i notMine = _mm256_cmpeq_epi8(_mm256_and_si256(cur, one), _mm256_setzero_si256());
+            __m256i adj = _mm256_and_si256(_mm256_add_epi8(sum, sum), _mm256_and_si256(notMine, adjMask));
+            cur = _mm256_or_si256(_mm256_andnot_si256(adjMask, cur), adj);
+            _mm256_storeu_si256((__m256i*)(p + idx), cur);
+        }
+#elif defined(GRID_USE_SSE2)
+        const __m128i one = _mm_set1_epi8(MINE_BIT);
+        const __m128i adjMask = _mm_set1_epi8((char)ADJ_MASK);
+        for (; idx + 16 <= end; idx += 16) {
+            __m128i sum = _mm_setzero_si128();
+            for (int d = 0; d < 8; d++) {
+                __m128i v = _mm_loadu_si128((const __m128i*)(p + idx + neighbors[d]));
+                sum = _mm_add_epi8(sum, _mm_and_si128(v, one));
+            }
+            __m128i cur = _mm_loadu_si128((const __m128i*)(p + idx));
+            __m128i notMine = _mm_cmpeq_epi8(_mm_and_si128(cur, one), _mm_setzero_si128());
+            __m128i adj = _mm_and_si128(_mm_add_epi8(sum, sum), _mm_and_si128(notMine, adjMask));
+            cur = _mm_or_si128(_mm_andnot_si128(adjMask, cur), adj);
+            _mm_storeu_si128((__m128i*)(p + idx), cur);
+        }
+#endif
+        for (; idx < end; idx++) {
+            int cnt = 0;
+            for (int d = 0; d < 8; d++) cnt += p[idx + neighbors[d]] & MINE_BIT;
+            int keep = (p[idx] & MINE_BIT) - 1;
+            p[idx] = (uint8_t)((p[idx] & ~ADJ_MASK) | ((cnt << ADJ_SHIFT) & keep));
+        }
+    }
+}
+
+int Grid::FloodReveal(int idx, std::vector<int>& work, std::vector<int>* opened) {
+    work.clear();
+    work.push_back(idx);
+    return Flood(work, opened);
+}
+
+int Grid::RevealBatch(const int* seeds, int count, std::vector<int>& work, std::vector<int>* opened) {
+    const uint8_t ZERO_MASK = ADJ_MASK | MINE_BIT;
+    const uint8_t REVEALED = (uint8_t)((int)CellState::Revealed << STATE_SHIFT);
+    uint8_t* p = cells.data();
+    int revealed = 0;
+
+    work.clear();
+    for (int i = 0; i < count; i++) {
+        int idx = seeds[i];
+        if ((p[idx] & STATE_MASK) || (p[idx] & MINE_BIT)) continue;
+        p[idx] |= REVEALED;
+        revealed++;
+        if (opened) opened->push_back(idx);
+        if ((p[idx] & ZERO_MASK) == 0) work.push_back(idx);
+    }
+    return revealed + Flood(work, opened);
+}
+
+// Pops revealed zero cells off work and reveals their hidden neighbors,
+// pushing the new zeros in turn.
+int Grid::Flood(std::vector<int>& work, std::vector<int>* opened) {
+    const uint8_t ZERO_MASK = ADJ_MASK | MINE_BIT;
+    const uint8_t REVEALED = (uint8_t)((int)CellState::Revealed << STATE_SHIFT);
+    uint8_t* p = cells.data();
+    int count = 0;
+
+    while (!work.empty()) {
+        int cur = work.back();
+        work.pop_back();
+        for (int d = 0; d < 8; d++) {
+            int n = cur + neighbors[d];
+            if (p[n] & STATE_MASK) continue; // only hidden cells have state 0
+            p[n] |= REVEALED;
+            count++;
+            if (opened) opened->push_back(n);
+            if ((p[n] & ZERO_MASK) == 0) work.push_back(n);
+        }
+    }
+    return count;
+}
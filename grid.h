@@ -0,0 +1,92 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class Bitboard;
+
+enum class CellState : uint8_t {
+    Hidden,
+    Revealed,
+    Flagged,
+    Questioned
+};
+
+// Flat row-major board with one byte per cell and a one-cell border on every
+// side. Cell byte layout: bit 0 mine, bits 1-4 adjacent count, bits 5-6 state.
+// Border cells are stored as revealed non-mines, so neighbor loops can use the
+// fixed offsets from Neighbors() without bounds checks.
+class Grid {
+public:
+    static const uint8_t MINE_BIT = 0x01;
+    static const uint8_t ADJ_SHIFT = 1;
+    static const uint8_t ADJ_MASK = 0x1E;
+    static const uint8_t STATE_SHIFT = 5;
+    static const uint8_t STATE_MASK = 0x60;
+    static const uint8_t BORDER_CELL = (uint8_t)((int)CellState::Revealed << STATE_SHIFT);
+
+    Grid(int rows = 0, int cols = 0);
+    void Resize(int rows, int cols);
+    void Clear() { Clear(0, rows); }
+
+    // Sets the mine bit of every cell set in mines (same dimensions).
+    void LoadMines(const Bitboard& mines) { LoadMines(mines, 0, rows); }
+    // Recomputes every adjacent count from the mine bits. Mines keep a count
+    // of zero. Vectorised with SSE2/AVX2 when the compiler targets them.
+    void ComputeAdjacency() { ComputeAdjacency(0, rows); }
+
+    // The same for the board rows [rowBegin, rowEnd) only, so that disjoint
+    // row ranges can be handled on different threads. Clear also resets the
+    // border rows its range touches. ComputeAdjacency reads the mine bits of
+    // the rows just outside its range: ranges running at the same time must
+    // not be adjacent.
+    void Clear(int rowBegin, int rowEnd);
+    void LoadMines(const Bitboard& mines, int rowBegin, int rowEnd);
+    void ComputeAdjacency(int rowBegin, int rowEnd);
+
+    // Reveals the opening around the already revealed zero cell idx using
+    // work as an explicit stack. Each cell is pushed at most once, so the
+    // stack never exceeds the number of zero cells and its capacity can be
+    // kept between calls. Returns the number of cells newly revealed and,
+    // if opened is given, appends their indices to it.
+    int FloodReveal(int idx, std::vector<int>& work, std::vector<int>* opened = nullptr);
+    // Reveals the hidden safe cells among seeds[0..count) and the openings
+    // around those that are zeros, all in one traversal sharing one stack.
+    // Mines and cells that are not hidden are skipped. Returns and appends
+    // like FloodReveal, the seeds first.
+    int RevealBatch(const int* seeds, int count, std::vector<int>& work, std::vector<int>* opened = nullptr);
+
+    int Rows() const { return rows; }
+    int Cols() const { return cols; }
+    int Stride() const { return stride; }
+    int PaddedSize() const { return (int)cells.size(); }
+
+    int Index(int row, int col) const { return (row + 1) * stride + col + 1; }
+    int RowOf(int idx) const { return idx / stride - 1; }
+    int ColOf(int idx) const { return idx % stride - 1; }
+    const int* Neighbors() const { return neighbors; }
+
+    bool IsMine(int idx) const { return (cells[idx] & MINE_BIT) != 0; }
+    int Adjacent(int idx) const { return (cells[idx] & ADJ_MASK) >> ADJ_SHIFT; }
+    CellState State(int idx) const { return (CellState)((cells[idx] & STATE_MASK) >> STATE_SHIFT); }
+
+    void SetMine(int idx, bool mine) { cells[idx] = (uint8_t)(mine ? (cells[idx] | MINE_BIT) : (cells[idx] & ~MINE_BIT)); }
+    void SetAdjacent(int idx, int n) { cells[idx] = (uint8_t)((cells[idx] & ~ADJ_MASK) | (n << ADJ_SHIFT)); }
+    void SetState(int idx, CellState s) { cells[idx] = (uint8_t)((cells[idx] & ~STATE_MASK) | ((int)s << STATE_SHIFT)); }
+
+    bool IsMine(int row, int col) const { return IsMine(Index(row, col)); }
+    int Adjacent(int row, int col) const { return Adjacent(Index(row, col)); }
+    CellState State(int row, int col) const { return State(Index(row, col)); }
+
+    uint8_t* Data() { return cells.data(); }
+    const uint8_t* Data() const { return cells.data(); }
+
+private:
+    int Flood(std::vector<int>& work, std::vector<int>* opened);
+
+    int rows = 0;
+    int cols = 0;
+    int stride = 2;
+    int neighbors[8] = { 0 };
+    std::vector<uint8_t> cells;
+};
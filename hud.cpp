@@ -0,0 +1,160 @@
+#include "hud.h"
+#include <cstdio>
+
+static const int BUTTON_W = 300;
+static const int BUTTON_H = 64;
+static const int BUTTON_SPACING = 20;
+static const int BUTTON_FONT = 28;
+static const int TITLE_FONT = 55;
+static const int OPTION_FONT = 20;
+static const int HINT_FONT = 28;
+static const int RESULT_FONT = 40;
+static const int RESULT_PADDING = 16;
+static const int FACE_SIZE = 40;
+
+void HudCounter::Place(int px, int py, bool right) {
+    x = px;
+    y = py;
+    alignRight = right;
+    Measure();
+}
+
+void HudCounter::Update(const char* f, int va, int vb) {
+    if (f == format && va == a && vb == b) return;
+    format = f;
+    a = va;
+    b = vb;
+    snprintf(text, sizeof(text), format, a, b);
+    Measure();
+}
+
+void HudCounter::Measure() {
+    int w = MeasureText(text, FONT) + PADDING * 2;
+    box = Rectangle{ (float)(alignRight ? x - w : x), (float)y, (float)w, (float)(FONT + PADDING) };
+}
+
+void HudCounter::Draw() const {
+    DrawRectangleRec(box, BLACK);
+    DrawRectangleLines((int)box.x, (int)box.y, (int)box.width, (int)box.height, WHITE);
+    DrawText(text, (int)box.x + PADDING, (int)box.y + ((int)box.height - FONT) / 2, FONT, RED);
+}
+
+void MenuButton::Place(Rectangle r, const char* label) {
+    rect = r;
+    text = label;
+    textX = (int)(rect.x + (rect.width - MeasureText(text, BUTTON_FONT)) / 2);
+    textY = (int)(rect.y + (rect.height - BUTTON_FONT) / 2);
+}
+
+void MenuButton::Draw(Vector2 mouse) const {
+    DrawRectangleRec(rect, Hit(mouse) ? Color{ 60,60,60,255 } : Color{ 40,40,40,255 });
+    DrawRectangleLines((int)rect.x, (int)rect.y, (int)rect.width, (int)rect.height, WHITE);
+    DrawText(text, textX, textY, BUTTON_FONT, RAYWHITE);
+}
+
+void Hud::Center(Text& t, const char* text, int font, int y) {
+    t.text = text;
+    t.width = MeasureText(text, font);
+    t.x = width / 2 - t.width / 2;
+    t.y = y;
+}
+
+void Hud::Layout(int w, int h) {
+    if (w == width && h == height) return;
+    width = w;
+    height = h;
+
+    int x = w / 2 - BUTTON_W / 2;
+    int top = h / 2 - (4 * BUTTON_H + 3 * BUTTON_SPACING) / 2;
+    Rectangle r = { (float)x, (float)top, (float)BUTTON_W, (float)BUTTON_H };
+    normal.Place(r, "Normal");
+    r.y += BUTTON_H + BUTTON_SPACING;
+    hard.Place(r, "Hard");
+    r.y += BUTTON_H + BUTTON_SPACING;
+    endless.Place(r, "Endless");
+    r.y += BUTTON_H + BUTTON_SPACING;
+    exit.Place(r, "Exit");
+
+    int below = (int)(r.y + r.height);
+    Center(title, "MINESWEEPER", TITLE_FONT, 80);
+    Center(noGuessOn, "No guessing: ON (G)", OPTION_FONT, below + 14);
+    Center(noGuessOff, "No guessing: OFF (G)", OPTION_FONT, below + 14);
+    Center(resume, "Resume saved game (R)", OPTION_FONT, below + 20 + OPTION_FONT);
+
+    // "Press Esc to return to the menu" with Esc in red, on one centred line.
+    int line1Y = h - 80;
+    escPre.text = "Press ";
+    escKey.text = "Esc";
+    escPost.text = " to return to the menu";
+    escPre.width = MeasureText(escPre.text, HINT_FONT);
+    escKey.width = MeasureText(escKey.text, HINT_FONT);
+    escPost.width = MeasureText(escPost.text, HINT_FONT);
+    escPre.x = w / 2 - (escPre.width + escKey.width + escPost.width) / 2;
+    escKey.x = escPre.x + escPre.width;
+    escPost.x = escKey.x + escKey.width;
+    escPre.y = escKey.y = escPost.y = line1Y;
+    Center(escSecond, "while in the game", HINT_FONT, line1Y + HINT_FONT + 6);
+
+    face = Rectangle{ (float)(w / 2 - FACE_SIZE / 2), 20.0f, (float)FACE_SIZE, (float)FACE_SIZE };
+    left.Place(20, 15, false);
+    right.Place(w - 20, 15, true);
+
+    int boxH = RESULT_FONT + (int)(RESULT_PADDING * 1.5f);
+    Center(win, "YOU WIN!", RESULT_FONT, h - boxH - 7 + RESULT_PADDING);
+    Center(lose, "GAME OVER!", RESULT_FONT, h - boxH - 7 + RESULT_PADDING);
+    winBox = Rectangle{ (float)(win.x - RESULT_PADDING), (float)(h - boxH - 7), (float)(win.width + RESULT_PADDING * 2), (float)boxH };
+    loseBox = Rectangle{ (float)(lose.x - RESULT_PADDING), (float)(h - boxH - 7), (float)(lose.width + RESULT_PADDING * 2), (float)boxH };
+
+    const char* noticeTexts[4] = { "", "Generating no-guess board...", "No guess-free board found", "Too many mines for no-guess" };
+    int noticeH = OPTION_FONT + RESULT_PADDING;
+    for (int i = 1; i < 4; i++) {
+        Center(notices[i], noticeTexts[i], OPTION_FONT, h - noticeH - 7 + RESULT_PADDING / 2);
+        noticeBoxes[i] = Rectangle{ (float)(notices[i].x - RESULT_PADDING), (float)(h - noticeH - 7), (float)(notices[i].width + RESULT_PADDING * 2), (float)noticeH };
+    }
+}
+
+void Hud::DrawMenu(Vector2 mouse, bool noGuess, bool hasSave) const {
+    DrawRectangle(0, 0, width, height, Color{ 100,149,237,255 });
+    DrawText(title.text, title.x, title.y, TITLE_FONT, RAYWHITE);
+
+    normal.Draw(mouse);
+    hard.Draw(mouse);
+    endless.Draw(mouse);
+    exit.Draw(mouse);
+
+    const Text& ng = noGuess ? noGuessOn : noGuessOff;
+    DrawText(ng.text, ng.x, ng.y, OPTION_FONT, noGuess ? GREEN : GRAY);
+    if (hasSave) DrawText(resume.text, resume.x, resume.y, OPTION_FONT, RAYWHITE);
+
+    DrawText(escPre.text, escPre.x, escPre.y, HINT_FONT, WHITE);
+    DrawText(escKey.text, escKey.x, escKey.y, HINT_FONT, RED);
+    DrawText(escPost.text, escPost.x, escPost.y, HINT_FONT, WHITE);
+    DrawText(escSecond.text, escSecond.x, escSecond.y, HINT_FONT, WHITE);
+}
+
+void Hud::DrawHeader() const {
+    DrawRectangle(0, 0, width, 60, Color{ 128,128,128 });
+    left.Draw();
+    right.Draw();
+}
+
+void Hud::DrawResult(bool won) const {
+    const Text& t = won ? win : lose;
+    const Rectangle& box = won ? winBox : loseBox;
+    DrawRectangleRec(box, Color{ 0,0,0,200 });
+    DrawRectangleLines((int)box.x, (int)box.y, (int)box.width, (int)box.height, WHITE);
+    DrawText(t.text, t.x, t.y, RESULT_FONT, won ? GREEN : RED);
+}
+
+void Hud::DrawNotice(Notice notice) const {
+    if (notice == Notice::None) return;
+    const Text& t = notices[(int)notice];
+    const Rectangle& box = noticeBoxes[(int)notice];
+    DrawRectangleRec(box, Color{ 0,0,0,200 });
+    DrawRectangleLines((int)box.x, (int)box.y, (int)box.width, (int)box.height, WHITE);
+    DrawText(t.text, t.x, t.y, OPTION_FONT, notice == Notice::Generating ? RAYWHITE : YELLOW);
+}
+
+bool Hud::OverHeader(Vector2 p) const {
+    return CheckCollisionPointRec(p, left.Bounds()) || CheckCollisionPointRec(p, right.Bounds()) || CheckCollisionPointRec(p, face);
+}
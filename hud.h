@@ -0,0 +1,100 @@
+#pragma once
+#include <raylib.h>
+
+// A boxed label such as "Bomb: 007" in the game header. The text is only
+// formatted and measured again when one of its values changes, so a frame
+// that shows the same numbers does no string work at all.
+class HudCounter {
+public:
+    // x is the box's left edge, or its right edge when alignRight is set.
+    void Place(int x, int y, bool alignRight);
+    // format is a printf format taking up to two ints; it must outlive the
+    // counter (a string literal).
+    void Update(const char* format, int a, int b = 0);
+    void Draw() const;
+    const Rectangle& Bounds() const { return box; }
+
+private:
+    void Measure();
+
+    static const int FONT = 25;
+    static const int PADDING = 25;
+
+    char text[32] = "";
+    const char* format = nullptr;
+    int a = 0;
+    int b = 0;
+    int x = 0;
+    int y = 0;
+    bool alignRight = false;
+    Rectangle box = { 0, 0, 0, 0 };
+};
+
+struct MenuButton {
+    Rectangle rect = { 0, 0, 0, 0 };
+    const char* text = "";
+    int textX = 0;
+    int textY = 0;
+
+    void Place(Rectangle r, const char* label);
+    void Draw(Vector2 mouse) const;
+    bool Hit(Vector2 p) const { return CheckCollisionPointRec(p, rect); }
+};
+
+// A line shown over the bottom of the board about the no-guess board of
+// the current game: still being generated, or why it is a normal one.
+enum class Notice {
+    None,
+    Generating,
+    NotFound,
+    TooDense
+};
+
+// Where everything of the menu and the game header goes. Layout measures
+// the fixed texts and places the buttons once per window size; the header
+// counters rebuild themselves when their values change.
+class Hud {
+public:
+    MenuButton normal;
+    MenuButton hard;
+    MenuButton endless;
+    MenuButton exit;
+    Rectangle face = { 0, 0, 0, 0 };
+    HudCounter left;
+    HudCounter right;
+
+    // Does nothing if the window size is unchanged.
+    void Layout(int windowWidth, int windowHeight);
+
+    void DrawMenu(Vector2 mouse, bool noGuess, bool hasSave) const;
+    void DrawHeader() const;
+    void DrawResult(bool won) const;
+    void DrawNotice(Notice notice) const;
+    // The header boxes and the face swallow clicks meant for the board.
+    bool OverHeader(Vector2 p) const;
+
+private:
+    struct Text {
+        const char* text = "";
+        int x = 0;
+        int y = 0;
+        int width = 0;
+    };
+
+    void Center(Text& t, const char* text, int font, int y);
+
+    int width = -1;
+    int height = -1;
+    Text title;
+    Text noGuessOn;
+    Text noGuessOff;
+    Text resume;
+    Text escPre, escKey, escPost, escSecond;
+    Text win;
+    Text lose;
+    Rectangle winBox = { 0, 0, 0, 0 };
+    Rectangle loseBox = { 0, 0, 0, 0 };
+    // Indexed by Notice; entry 0 is unused.
+    Text notices[4];
+    Rectangle noticeBoxes[4] = {};
+};
@@ -0,0 +1,76 @@
+#include "latency.h"
+#include "game.h"
+#include <algorithm>
+
+static double Millis(LatencyHarness::Clock::duration d) {
+    return std::chrono::duration<double, std::milli>(d).count();
+}
+
+static LatencyHarness::Clock::duration Gap(Xoshiro256& rng, double minMs, double maxMs) {
+    double ms = minMs + (maxMs - minMs) * (double)(rng.Next() >> 11) * (1.0 / 9007199254740992.0);
+    return std::chrono::duration_cast<LatencyHarness::Clock::duration>(std::chrono::duration<double, std::milli>(ms));
+}
+
+void LatencyHarness::Start(int clicks, double minGapMs, double maxGapMs, uint64_t seed) {
+    count = clicks;
+    polled = 0;
+    minGap = minGapMs;
+    maxGap = maxGapMs;
+    rng.Seed(seed);
+    next = Clock::now() + Gap(rng, minGap, maxGap);
+    unshown.clear();
+    stateLatencies.clear();
+    presentLatencies.clear();
+    stateLatencies.reserve((size_t)count);
+    presentLatencies.reserve((size_t)count);
+}
+
+bool LatencyHarness::Poll(Clock::time_point now, Clock::time_point& at) {
+    if (polled >= count || now < next) return false;
+    at = current = next;
+    polled++;
+    next += Gap(rng, minGap, maxGap);
+    return true;
+}
+
+bool LatencyHarness::Target(const Game& game, int& row, int& col) {
+    int cells = game.rows * game.cols;
+    int start = (int)rng.Below((uint64_t)cells);
+    for (int i = 0; i < cells; i++) {
+        int cell = (start + i) % cells;
+        if (game.grid.State(cell / game.cols, cell % game.cols) == CellState::Hidden) {
+            row = cell / game.cols;
+            col = cell % game.cols;
+            return true;
+        }
+    }
+    return false;
+}
+
+void LatencyHarness::StateChanged(Clock::time_point at) {
+    stateLatencies.push_back(Millis(at - current));
+    unshown.push_back(current);
+}
+
+void LatencyHarness::Presented(Clock::time_point at) {
+    for (Clock::time_point t : unshown) presentLatencies.push_back(Millis(at - t));
+    unshown.clear();
+}
+
+static double Percentile(const std::vector<double>& sorted, double p) {
+    if (sorted.empty()) return 0.0;
+    size_t i = (size_t)(p * (double)(sorted.size() - 1) + 0.5);
+    return sorted[std::min(i, sorted.size() - 1)];
+}
+
+void LatencyHarness::Print(FILE* out) const {
+    const char* names[2] = { "input to state change", "input to present" };
+    const std::vector<double>* samples[2] = { &stateLatencies, &presentLatencies };
+    fprintf(out, "%d synthetic clicks, %.0f-%.0f ms apart\n", count, minGap, maxGap);
+    for (int k = 0; k < 2; k++) {
+        std::vector<double> sorted = *samples[k];
+        std::sort(sorted.begin(), sorted.end());
+        fprintf(out, "%s (ms): p50=%.2f p90=%.2f p99=%.2f max=%.2f\n", names[k], Percentile(sorted, 0.50),
+                Percentile(sorted, 0.90), Percentile(sorted, 0.99), sorted.empty() ? 0.0 : sorted.back());
+    }
+}
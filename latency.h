@@ -0,0 +1,52 @@
+#pragma once
+#include "gameclock.h"
+#include "rng.h"
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+class Game;
+
+// Measures input latency through the game loop with synthetic clicks. The
+// clicks are scheduled at random times, the way the OS would deliver them
+// while a frame is in progress. The loop takes a click once it is due, the
+// next time it polls input, and reports when the click changed the game and
+// when the frame that shows the change was presented. Both latencies are
+// measured from the click's scheduled time, so waiting for the next poll
+// counts too.
+class LatencyHarness {
+public:
+    typedef GameClock::Clock Clock;
+
+    // Schedules count clicks with gaps drawn uniformly from
+    // [minGapMs, maxGapMs], starting from now.
+    void Start(int count, double minGapMs, double maxGapMs, uint64_t seed);
+    bool Active() const { return count > 0; }
+    // All clicks have been presented.
+    bool Done() const { return Active() && presentLatencies.size() == (size_t)count; }
+
+    // True if a click is due at now; its scheduled time goes to at. At most
+    // one click per poll, as a frame sees one press per button.
+    bool Poll(Clock::time_point now, Clock::time_point& at);
+    // A hidden cell of game to click on; false if there is none.
+    bool Target(const Game& game, int& row, int& col);
+    // The click from the last Poll has been applied to the game.
+    void StateChanged(Clock::time_point at);
+    // A frame was presented; every applied click not yet shown is now.
+    void Presented(Clock::time_point at);
+
+    // Percentiles of both latencies in milliseconds.
+    void Print(FILE* out) const;
+
+private:
+    int count = 0;
+    int polled = 0;
+    Clock::time_point next;
+    Clock::time_point current;
+    double minGap = 0.0;
+    double maxGap = 0.0;
+    Xoshiro256 rng;
+    std::vector<Clock::time_point> unshown;
+    std::vector<double> stateLatencies;
+    std::vector<double> presentLatencies;
+};
@@ -0,0 +1,319 @@
+#include "bot.h"
+#include "game.h"
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+struct LoadConfig {
+    std::string socketPath = "minesweeper.sock";
+    int port = 0;
+    int connections = 4;
+    // Boards per connection; each round sends one move for every board.
+    int sessions = 256;
+    double seconds = 5.0;
+    int rows = 16;
+    int cols = 16;
+    int mines = 40;
+    uint64_t seed = 0;
+    std::string bot = "simple";
+};
+
+// Replies are at most about 45 bytes (NEW's two 64-bit numbers), so a
+// round's replies stay well under the server's 1 MiB backlog limit, at
+// which it stops reading from the connection.
+static const int MAX_SESSIONS = 16384;
+
+struct ClientResult {
+    long long moves = 0;
+    long long games = 0;
+    long long wins = 0;
+    long long mismatches = 0;
+    std::vector<double> latencies;
+    std::string error;
+};
+
+// A board on the server and its copy here, which the bot reads and every
+// reply is checked against.
+struct RemoteBoard {
+    uint64_t id = 0;
+    Game game;
+    std::unique_ptr<Bot> bot;
+    long long moves = 0;
+};
+
+static void Usage() {
+    printf("usage: minesweeper-load [--socket PATH | --port N] [--connections N] [--sessions N]\n"
+           "                        [--seconds S] [--rows N] [--cols N] [--mines N] [--seed S]\n"
+           "                        [--bot random|simple|solver]\n");
+}
+
+static bool ParseArgs(int argc, char** argv, LoadConfig& cfg) {
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        if (i + 1 >= argc) return false;
+        const char* val = argv[++i];
+        if (strcmp(arg, "--socket") == 0) cfg.socketPath = val;
+        else if (strcmp(arg, "--port") == 0) cfg.port = atoi(val);
+        else if (strcmp(arg, "--connections") == 0) cfg.connections = atoi(val);
+        else if (strcmp(arg, "--sessions") == 0) cfg.sessions = atoi(val);
+        else if (strcmp(arg, "--seconds") == 0) cfg.seconds = atof(val);
+        else if (strcmp(arg, "--rows") == 0) cfg.rows = atoi(val);
+        else if (strcmp(arg, "--cols") == 0) cfg.cols = atoi(val);
+        else if (strcmp(arg, "--mines") == 0) cfg.mines = atoi(val);
+        else if (strcmp(arg, "--seed") == 0) cfg.seed = strtoull(val, nullptr, 0);
+        else if (strcmp(arg, "--bot") == 0) cfg.bot = val;
+        else return false;
+    }
+    return cfg.connections > 0 && cfg.sessions > 0 && cfg.sessions <= MAX_SESSIONS && cfg.seconds > 0 && cfg.rows > 0 && cfg.cols > 0 &&
+           cfg.mines >= 0 && cfg.mines <= cfg.rows * cfg.cols - 9;
+}
+
+static int Connect(const LoadConfig& cfg) {
+    int fd;
+    if (cfg.port > 0) {
+        fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (fd < 0) return -1;
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        sockaddr_in addr = {};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons((uint16_t)cfg.port);
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        if (connect(fd, (sockaddr*)&addr, sizeof(addr)) < 0) { close(fd); return -1; }
+    } else {
+        sockaddr_un addr = {};
+        if (cfg.socketPath.size() >= sizeof(addr.sun_path)) return -1;
+        fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (fd < 0) return -1;
+        addr.sun_family = AF_UNIX;
+        memcpy(addr.sun_path, cfg.socketPath.c_str(), cfg.socketPath.size() + 1);
+        if (connect(fd, (sockaddr*)&addr, sizeof(addr)) < 0) { close(fd); return -1; }
+    }
+    return fd;
+}
+
+// Reply lines from a non-blocking socket.
+class LineReader {
+public:
+    explicit LineReader(int fd) : fd(fd) {}
+
+    // Reads what has arrived. False once the server has gone away; lines
+    // that came before that can still be taken.
+    bool Fill() {
+        buf.erase(0, start);
+        start = 0;
+        for (;;) {
+            char chunk[65536];
+            ssize_t n = recv(fd, chunk, sizeof(chunk), 0);
+            if (n > 0) {
+                buf.append(chunk, (size_t)n);
+                continue;
+            }
+            if (n < 0 && errno == EINTR) continue;
+            return n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK);
+        }
+    }
+
+    // The next complete line without its newline, valid until the next
+    // Fill; null if none has arrived yet.
+    const char* Next() {
+        size_t end = buf.find('\n', start);
+        if (end == std::string::npos) return nullptr;
+        buf[end] = 0;
+        const char* line = buf.c_str() + start;
+        start = end + 1;
+        return line;
+    }
+
+private:
+    int fd;
+    std::string buf;
+    size_t start = 0;
+};
+
+// Writes batch and reads its `replies` reply lines, both as the socket
+// allows, so neither side can block on a full buffer while the other waits
+// for it to read. handle gets each reply in order. False if the server went
+// away first.
+template <class Handle>
+static bool Exchange(int fd, const std::string& batch, size_t replies, LineReader& reader, Handle handle) {
+    size_t sent = 0, got = 0;
+    while (got < replies) {
+        pollfd p = { fd, (short)(POLLIN | (sent < batch.size() ? POLLOUT : 0)), 0 };
+        if (poll(&p, 1, -1) < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        if (sent < batch.size() && (p.revents & POLLOUT)) {
+            ssize_t n = send(fd, batch.data() + sent, batch.size() - sent, MSG_NOSIGNAL);
+            if (n > 0) sent += (size_t)n;
+            else if (n < 0 && errno != EINTR && errno != EAGAIN && errno != EWOULDBLOCK) return false;
+        }
+        if (p.revents & (POLLIN | POLLHUP | POLLERR)) {
+            bool open = reader.Fill();
+            const char* line;
+            while (got < replies && (line = reader.Next())) handle(got++, line);
+            if (!open) return got == replies;
+        }
+    }
+    return true;
+}
+
+static const char* StateName(const Game& game) {
+    return game.victory ? "won" : (game.gameOver ? "lost" : "playing");
+}
+
+// Runs one connection: opens its boards, then plays rounds until the time
+// is up. A round pipelines one line per board and reads the replies while
+// it writes. A move's latency runs from the start of the round to its
+// reply, so it includes the moves queued ahead of it in the same round;
+// --sessions 1 gives the round trip of a single move.
+static void RunClient(const LoadConfig& cfg, int index, ClientResult& out) {
+    typedef std::chrono::steady_clock Clock;
+    int fd = Connect(cfg);
+    if (fd < 0) {
+        out.error = std::string("cannot connect: ") + strerror(errno);
+        return;
+    }
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    LineReader reader(fd);
+    long long maxMoves = 3LL * cfg.rows * cfg.cols;
+    uint64_t seeds = cfg.seed + (uint64_t)index * 0x9E3779B97F4A7C15ULL;
+    std::vector<RemoteBoard> boards((size_t)cfg.sessions);
+
+    // What each line of the batch was, in order.
+    enum class Sent { Move, Close, New };
+    struct Pending {
+        Sent kind;
+        size_t board;
+        uint64_t seed;
+    };
+    std::vector<Pending> pending;
+    std::string batch;
+    char line[96];
+
+    auto requestNew = [&](size_t b) {
+        RemoteBoard& board = boards[b];
+        uint64_t seed = SplitMix64(seeds);
+        snprintf(line, sizeof(line), "NEW %d %d %d %llu\n", cfg.rows, cfg.cols, cfg.mines, (unsigned long long)seed);
+        batch += line;
+        pending.push_back(Pending{ Sent::New, b, seed });
+        board.game.Init(cfg.rows, cfg.cols, cfg.mines, seed);
+        if (!board.bot) board.bot = MakeBot(cfg.bot, (uint64_t)index);
+        board.bot->NewGame(board.game);
+        board.moves = 0;
+    };
+    for (size_t b = 0; b < boards.size(); b++) requestNew(b);
+
+    Clock::time_point deadline = Clock::now() + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(cfg.seconds));
+    for (bool first = true; first || Clock::now() < deadline; first = false) {
+        if (!first) {
+            batch.clear();
+            pending.clear();
+            for (size_t b = 0; b < boards.size(); b++) {
+                RemoteBoard& board = boards[b];
+                Game& game = board.game;
+                if (game.gameOver || game.victory || board.moves >= maxMoves) {
+                    out.games++;
+                    out.wins += game.victory;
+                    snprintf(line, sizeof(line), "CLOSE %llu\n", (unsigned long long)board.id);
+                    batch += line;
+                    pending.push_back(Pending{ Sent::Close, b, 0 });
+                    requestNew(b);
+                    continue;
+                }
+                Move m = board.bot->NextMove(game);
+                game.HandleClick(m.row, m.col, m.leftClick);
+                board.moves++;
+                snprintf(line, sizeof(line), "%s %llu %d %d\n", m.leftClick ? "CLICK" : "FLAG", (unsigned long long)board.id, m.row, m.col);
+                batch += line;
+                pending.push_back(Pending{ Sent::Move, b, 0 });
+            }
+        }
+
+        Clock::time_point start = Clock::now();
+        auto check = [&](size_t n, const char* reply) {
+            Clock::time_point now = Clock::now();
+            RemoteBoard& board = boards[pending[n].board];
+            if (pending[n].kind == Sent::Close) {
+                out.mismatches += strcmp(reply, "OK") != 0;
+            } else if (pending[n].kind == Sent::New) {
+                unsigned long long id, seed;
+                if (sscanf(reply, "OK %llu %llu", &id, &seed) != 2 || seed != pending[n].seed) out.mismatches++;
+                else board.id = id;
+            } else {
+                out.latencies.push_back(std::chrono::duration<double, std::micro>(now - start).count());
+                out.moves++;
+                char expected[64];
+                snprintf(expected, sizeof(expected), "OK %s %d %d", StateName(board.game), board.game.revealedCnt, board.game.flagsLeft);
+                out.mismatches += strcmp(reply, expected) != 0;
+            }
+        };
+        if (!Exchange(fd, batch, pending.size(), reader, check)) {
+            out.error = "server closed the connection";
+            break;
+        }
+    }
+    close(fd);
+}
+
+static double Percentile(const std::vector<double>& sorted, double p) {
+    if (sorted.empty()) return 0.0;
+    size_t i = (size_t)(p * (double)(sorted.size() - 1) + 0.5);
+    return sorted[std::min(i, sorted.size() - 1)];
+}
+
+int main(int argc, char** argv) {
+    LoadConfig cfg;
+    if (!ParseArgs(argc, argv, cfg)) { Usage(); return 1; }
+    if (!MakeBot(cfg.bot, 0)) { fprintf(stderr, "unknown bot '%s'\n", cfg.bot.c_str()); return 1; }
+    if (cfg.seed == 0) cfg.seed = RandomSeed();
+
+    std::vector<ClientResult> results((size_t)cfg.connections);
+    std::vector<std::thread> clients;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int c = 0; c < cfg.connections; c++) {
+        clients.emplace_back(RunClient, std::cref(cfg), c, std::ref(results[(size_t)c]));
+    }
+    for (std::thread& t : clients) t.join();
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    ClientResult total;
+    for (const ClientResult& r : results) {
+        total.moves += r.moves;
+        total.games += r.games;
+        total.wins += r.wins;
+        total.mismatches += r.mismatches;
+        total.latencies.insert(total.latencies.end(), r.latencies.begin(), r.latencies.end());
+        if (!r.error.empty() && total.error.empty()) total.error = r.error;
+    }
+    std::sort(total.latencies.begin(), total.latencies.end());
+
+    printf("connections=%d boards=%d board=%dx%d mines=%d bot=%s seconds=%.1f\n", cfg.connections,
+           cfg.connections * cfg.sessions, cfg.rows, cfg.cols, cfg.mines, cfg.bot.c_str(), elapsed);
+    printf("moves/sec: %.1f\n", (double)total.moves / elapsed);
+    printf("games/sec: %.1f (win rate %.2f%%)\n", (double)total.games / elapsed,
+           total.games ? 100.0 * (double)total.wins / (double)total.games : 0.0);
+    printf("latency per move, %d pipelined per round (us): p50=%.1f p90=%.1f p99=%.1f max=%.1f\n", cfg.sessions,
+           Percentile(total.latencies, 0.50),
+           Percentile(total.latencies, 0.90), Percentile(total.latencies, 0.99),
+           total.latencies.empty() ? 0.0 : total.latencies.back());
+    printf("mismatched replies: %lld\n", total.mismatches);
+    if (!total.error.empty()) fprintf(stderr, "error: %s\n", total.error.c_str());
+    return total.error.empty() && total.mismatches == 0 ? 0 : 1;
+}
@@ -1,9 +1,21 @@
 #include <raylib.h>
+#include "alloccount.h"
+#include "board.h"
 #include "game.h"
-#include <ctime>
+#include "hud.h"
+#include "latency.h"
+#include "renderer.h"
+#include "noguess.h"
+#include "probability.h"
+#include "snapshot.h"
+#include "solver.h"
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
+#include <memory>
 #include <string>
 #include <algorithm>
+#include <chrono>
 
 static void SetWindowSizeCentered(int newW, int newH) {
 	int curW = GetScreenWidth();
@@ -23,26 +35,78 @@ static void SetWindowSizeCentered(int newW, int newH) {
 	SetWindowPosition(newX, newY);
 }
 
-enum class AppState { Menu, Playing };
+static const int MARGIN = 60;
+// Boards larger than this are seen through the camera instead of growing the window.
+static const int MAX_VIEW_W = 25 * CELL_SIZE;
+static const int MAX_VIEW_H = 16 * CELL_SIZE;
 
-int main() {
-	srand((unsigned)time(nullptr));
-
-	const int NORMAL_ROWS = 9;
-	const int NORMAL_COLS = 9;
-	const int NORMAL_MINES = 10;
+static void GridWindowSize(int rows, int cols, int& w, int& h) {
+	w = std::min(cols * CELL_SIZE, MAX_VIEW_W) + MARGIN * 2;
+	h = std::min(rows * CELL_SIZE, MAX_VIEW_H) + MARGIN * 2 + 40;
+}
 
-	const int HARD_ROWS = 16;
-	const int HARD_COLS = 16;
-	const int HARD_MINES = 40;
+static void SetGridViewport(GameRenderer& renderer, int windowWidth, int windowHeight) {
+	renderer.SetViewport(MARGIN, MARGIN + 20, windowWidth - MARGIN * 2, windowHeight - (MARGIN + 20) * 2);
+}
 
-	const int MARGIN = 60;
+enum class AppState { Menu, Playing, Endless };
+
+int main(int argc, char** argv) {
+	// Time to first frame is measured from here and logged once.
+	Profiler::Clock::time_point launched = Profiler::Clock::now();
+	bool presented = false;
+
+	const int NORMAL_ROWS = NormalBoard::ROWS;
+	const int NORMAL_COLS = NormalBoard::COLS;
+	const int NORMAL_MINES = NormalBoard::MINES;
+
+	const int HARD_ROWS = HardBoard::ROWS;
+	const int HARD_COLS = HardBoard::COLS;
+	const int HARD_MINES = HardBoard::MINES;
+
+	// When no ready board fits the first click, one is generated in the
+	// background in rounds of NOGUESS_TRIES candidates. After NOGUESS_ROUNDS
+	// rounds the game gives up and plays a normal board.
+	const int NOGUESS_TRIES = 2000;
+	const int NOGUESS_ROUNDS = 25;
+
+	const float ENDLESS_DENSITY = 0.16f;
+	// Chunks farther than this from the last click are evicted or compressed.
+	const int ENDLESS_KEEP_CHUNKS = 8;
+
+	// Esc from an unfinished game saves it here; R in the menu resumes it.
+	const char* SAVE_FILE = "savegame.mss";
+
+	// --rows/--cols/--mines start a custom board straight away.
+	int customRows = 0, customCols = 0, customMines = 0;
+	// --trace FILE records a Chrome trace from startup and writes it on exit.
+	std::string traceFile = "trace.json";
+	bool traceOnStart = false;
+	// --continuous redraws every frame instead of only when something changed.
+	bool continuous = false;
+	// --latency N plays N synthetic clicks on a normal board, prints the
+	// input latency percentiles and exits.
+	int latencyClicks = 0;
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "--continuous") == 0) continuous = true;
+		else if (i + 1 >= argc) break;
+		else if (strcmp(argv[i], "--latency") == 0) latencyClicks = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--rows") == 0) customRows = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--cols") == 0) customCols = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--mines") == 0) customMines = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--trace") == 0) { traceFile = argv[++i]; traceOnStart = true; }
+	}
+	bool custom = customRows > 0 && customCols > 0 && customMines > 0 && customMines <= customRows * customCols - 9;
 
-	int windowWidth = NORMAL_COLS * CELL_SIZE + MARGIN * 2;
-	int windowHeight = NORMAL_ROWS * CELL_SIZE + MARGIN * 2 + 40;
+	int windowWidth, windowHeight;
+	GridWindowSize(NORMAL_ROWS, NORMAL_COLS, windowWidth, windowHeight);
 
 	InitWindow(windowWidth, windowHeight, "Minesweeper");
-	Image icon = LoadImage("Graphics/logo1.png");
+	// Sprites, glyphs and the icon are compiled in (see tools/pack_assets.py),
+	// so nothing is read from disk before the first frame.
+	Image atlasImage = { (void*)ATLAS_PIXELS, ATLAS_WIDTH, ATLAS_HEIGHT, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+	const SpriteRect& iconRect = SPRITES[SPRITE_ICON];
+	Image icon = ImageFromImage(atlasImage, Rectangle{ (float)iconRect.x, (float)iconRect.y, (float)iconRect.width, (float)iconRect.height });
 	SetWindowIcon(icon);
 	UnloadImage(icon);
 
@@ -51,251 +115,496 @@ int main() {
 	SetExitKey(KEY_NULL);
 
 	Game game(NORMAL_ROWS, NORMAL_COLS, NORMAL_MINES);
-
-	Texture2D bombTex = LoadTexture("Graphics/bomb1.png");
-	Texture2D bomb2Tex = LoadTexture("Graphics/bomb2.png");
-	Texture2D questionTex = LoadTexture("Graphics/question1.png");
-	Texture2D flagTex = LoadTexture("Graphics/flag1.png");
-	Texture2D face1 = LoadTexture("Graphics/face01.png");
-	Texture2D face2 = LoadTexture("Graphics/face02.png");
-	Texture2D face3 = LoadTexture("Graphics/face03.png");
-	Texture2D face4 = LoadTexture("Graphics/face04.png");
-	game.SetTextures(bombTex, bomb2Tex, questionTex, flagTex);
-	game.SetFaceTextures(face1, face2, face3, face4);
-
-	const int gridOffsetX = MARGIN;
-	const int gridOffsetY = MARGIN + 20;
+	GameRenderer renderer;
+	EndlessBoard endless;
+	Solver solver;
+	int hintRow = -1, hintCol = -1;
+	bool hintMine = false;
+	ProbabilityEngine probs;
+	bool noGuess = false;
+	// Started on the first G press, so its threads only run for players who use it.
+	std::unique_ptr<BoardPool> boardPool;
+	// The first click of a no-guess game, held while its board is generated.
+	NoGuessJob noGuessJob;
+	int pendingRow = 0, pendingCol = 0;
+	uint64_t pendingSeed = 0;
+	// Shown for the game with seed noticeSeed until it ends.
+	Notice notice = Notice::None;
+	uint64_t noticeSeed = 0;
+	Bitboard layout;
+	bool replaySaved = false;
+	bool showProbs = false;
+	size_t probsLog = 0;
+	uint64_t probsSeed = 0;
+	bool hasSave = FileExists(SAVE_FILE);
+	// F3 shows frame and zone timings; F4 starts and stops a trace.
+	Profiler profiler;
+	bool showProfiler = false;
+	std::vector<Profiler::ZoneStats> profile;
+	game.profiler = &profiler;
+	if (traceOnStart) profiler.StartTrace();
+
+	renderer.LoadSprites();
 
 	AppState state = AppState::Menu;
+	bool showRenderStats = false;
+	SetGridViewport(renderer, windowWidth, windowHeight);
+
+	if (custom) {
+		GridWindowSize(customRows, customCols, windowWidth, windowHeight);
+		SetWindowSizeCentered(windowWidth, windowHeight);
+		SetGridViewport(renderer, windowWidth, windowHeight);
+		game.Init(customRows, customCols, customMines);
+		renderer.ResetCamera(game);
+		state = AppState::Playing;
+	}
+	LatencyHarness latency;
+	if (latencyClicks > 0) {
+		GridWindowSize(NORMAL_ROWS, NORMAL_COLS, windowWidth, windowHeight);
+		SetWindowSizeCentered(windowWidth, windowHeight);
+		SetGridViewport(renderer, windowWidth, windowHeight);
+		game.Init(NORMAL_ROWS, NORMAL_COLS, NORMAL_MINES);
+		renderer.ResetCamera(game);
+		state = AppState::Playing;
+		latency.Start(latencyClicks, 5.0, 60.0, RandomSeed());
+	}
+
+	Hud hud;
+	size_t frameAllocations = 0;
 
-	const int btnW = 300;
-	const int btnH = 64;
-	const int btnSpacing = 20;
+	// Idle mode: a frame is only drawn when input arrived, the board or the
+	// hover target changed, or the clock shows a new second. In between the
+	// loop sleeps in PollInputEvents, either until the next input (nothing
+	// is ticking) or for one frame at a time while the game clock runs.
+	bool eventWaiting = false;
+	int drawnSeconds = -1;
+	int drawnHover = -1;
+	bool drawnOnce = false;
+	double lastTime = GetTime();
 
 	while (!WindowShouldClose()) {
-		if (state == AppState::Playing) {
-			if (!game.gameOver && !game.victory && !game.firstClick)
-				game.timer += GetFrameTime();
+		size_t allocationsBefore = HeapAllocations();
+		profiler.BeginFrame();
+		Profiler::Clock::time_point updateStart = Profiler::Clock::now();
+		// Frames can be skipped, so elapsed time comes from the clock rather
+		// than from GetFrameTime.
+		double now = GetTime();
+		float dt = (float)(now - lastTime);
+		lastTime = now;
+
+		// raylib gives no event timestamps, so input is stamped with the time
+		// the loop polled it: right after the previous frame, or on waking.
+		// The game clocks start and stop at these stamps.
+		GameClock::Clock::time_point inputAt = updateStart;
+		Vector2 mouse = GetMousePosition();
+		Vector2 mouseDelta = GetMouseDelta();
+		bool leftPressed = IsMouseButtonPressed(MOUSE_LEFT_BUTTON);
+		Vector2 leftAt = mouse;
+		// A synthetic click arrives like a real one, at a hidden cell, but
+		// carries the time it was scheduled for.
+		bool injected = state == AppState::Playing && latency.Poll(updateStart, inputAt);
+		if (injected) {
+			if (game.gameOver || game.victory) game.NewGame();
+			int row, col;
+			latency.Target(game, row, col);
+			Vector2 center = { ((float)col + 0.5f) * CELL_SIZE, ((float)row + 0.5f) * CELL_SIZE };
+			leftPressed = true;
+			leftAt = GetWorldToScreen2D(center, renderer.camera);
+		}
+		bool input = injected || GetKeyPressed() != 0 || GetMouseWheelMove() != 0.0f || IsWindowResized()
+			|| IsMouseButtonPressed(MOUSE_LEFT_BUTTON) || IsMouseButtonPressed(MOUSE_RIGHT_BUTTON) || IsMouseButtonPressed(MOUSE_MIDDLE_BUTTON)
+			|| IsMouseButtonReleased(MOUSE_LEFT_BUTTON) || IsMouseButtonReleased(MOUSE_RIGHT_BUTTON) || IsMouseButtonReleased(MOUSE_MIDDLE_BUTTON)
+			|| IsKeyDown(KEY_LEFT) || IsKeyDown(KEY_RIGHT) || IsKeyDown(KEY_UP) || IsKeyDown(KEY_DOWN)
+			|| ((mouseDelta.x != 0.0f || mouseDelta.y != 0.0f) && IsKeyDown(KEY_SPACE) && IsMouseButtonDown(MOUSE_LEFT_BUTTON));
+
+		if (IsKeyPressed(KEY_F1)) showRenderStats = !showRenderStats;
+		if (IsKeyPressed(KEY_F2)) renderer.useCache = !renderer.useCache;
+		if (IsKeyPressed(KEY_F3)) showProfiler = !showProfiler;
+		if (IsKeyPressed(KEY_F4)) {
+			if (profiler.Tracing()) profiler.StopTrace(traceFile);
+			else profiler.StartTrace();
+		}
+		profiler.enabled = showProfiler || profiler.Tracing();
+		if (IsKeyPressed(KEY_G) && state == AppState::Menu) {
+			noGuess = !noGuess;
+			if (noGuess) {
+				if (!boardPool) boardPool.reset(new BoardPool());
+				boardPool->Prefetch(BoardSpec{ NORMAL_ROWS, NORMAL_COLS, NORMAL_MINES });
+				boardPool->Prefetch(BoardSpec{ HARD_ROWS, HARD_COLS, HARD_MINES });
+				BoardSpec customSpec = { customRows, customCols, customMines };
+				if (custom && NoGuessFeasible(customSpec)) boardPool->Prefetch(customSpec);
+			}
+		}
+		if (state == AppState::Playing && (IsKeyDown(KEY_LEFT_CONTROL) || IsKeyDown(KEY_RIGHT_CONTROL))) {
+			if (IsKeyPressed(KEY_Z) && game.Undo()) game.SyncClock(inputAt);
+			if (IsKeyPressed(KEY_Y) && game.Redo()) game.SyncClock(inputAt);
+		}
+		if (IsKeyPressed(KEY_H) && state == AppState::Playing) {
+			if (!solver.Hint(game, hintRow, hintCol, hintMine)) hintRow = -1;
+		}
+		if (IsKeyPressed(KEY_P) && state == AppState::Playing) {
+			showProbs = !showProbs;
+			probsSeed = game.GetSeed() + 1; // force a recompute
+		}
+		if (showProbs && state == AppState::Playing && !game.firstClick && !game.gameOver
+			&& (game.revealLog.size() != probsLog || game.GetSeed() != probsSeed)) {
+			probs.Compute(game);
+			probsLog = game.revealLog.size();
+			probsSeed = game.GetSeed();
+		}
+		renderer.probabilities = showProbs && state == AppState::Playing && !game.firstClick && !game.gameOver ? &probs.Probabilities() : nullptr;
+		// A hint lasts until it is played or the board restarts.
+		if (hintRow >= 0) {
+			CellState s = game.grid.State(hintRow, hintCol);
+			if (state != AppState::Playing || game.firstClick || game.gameOver || (hintMine ? s == CellState::Flagged : s == CellState::Revealed))
+				hintRow = -1;
+		}
+
+		if (IsKeyPressed(KEY_R) && state == AppState::Menu && hasSave) {
+			Game saved;
+			if (LoadSnapshot(saved, SAVE_FILE)) {
+				int newW, newH;
+				GridWindowSize(saved.rows, saved.cols, newW, newH);
+				SetWindowSizeCentered(newW, newH);
+				windowWidth = newW; windowHeight = newH;
+				SetGridViewport(renderer, windowWidth, windowHeight);
+
+				game = std::move(saved);
+				game.profiler = &profiler;
+				game.SyncClock(inputAt);
+				solver.Reset(game);
+				probsSeed = game.GetSeed() + 1;
+				renderer.ResetCamera(game);
+				state = AppState::Playing;
+			}
+			remove(SAVE_FILE);
+			hasSave = false;
 		}
 
 		if (IsKeyPressed(KEY_ESCAPE)) {
-			if (state == AppState::Playing) {
+			if (state == AppState::Playing && !game.firstClick && !game.gameOver && !game.victory)
+				hasSave = SaveSnapshot(game, SAVE_FILE);
+			if (state != AppState::Menu) {
 				state = AppState::Menu;
-				int newW = NORMAL_COLS * CELL_SIZE + MARGIN * 2;
-				int newH = NORMAL_ROWS * CELL_SIZE + MARGIN * 2 + 40;
+				int newW, newH;
+				GridWindowSize(NORMAL_ROWS, NORMAL_COLS, newW, newH);
 				SetWindowSizeCentered(newW, newH);
 				windowWidth = newW; windowHeight = newH;
+				SetGridViewport(renderer, windowWidth, windowHeight);
 			}
 		}
 
-		int menuCenterX = windowWidth / 2;
-		int menuCenterY = windowHeight / 2;
-		int totalBtnsH = 3 * btnH + 2 * btnSpacing;
-		int topY = menuCenterY - totalBtnsH / 2;
-		Rectangle startBtn = { (float)(menuCenterX - btnW / 2), (float)(topY), (float)btnW, (float)btnH };
-		Rectangle hardBtn = { (float)(menuCenterX - btnW / 2), (float)(topY + btnH + btnSpacing), (float)btnW, (float)btnH };
-		Rectangle exitBtn = { (float)(menuCenterX - btnW / 2), (float)(topY + (btnH + btnSpacing) * 2), (float)btnW, (float)btnH };
-
-		int winWidthForGrid = gridOffsetX * 2 + game.GetCols() * CELL_SIZE;
-		int faceDrawSize = 40;
-		float faceX = (float)(winWidthForGrid / 2 - faceDrawSize / 2);
-		float faceY = 20.0f;
-		Rectangle faceRect = { faceX, faceY, (float)faceDrawSize, (float)faceDrawSize };
-
-		std::string bombsText = std::to_string(game.flagsLeft);
-		if (bombsText.length() < 3) bombsText = std::string(3 - bombsText.length(), '0') + bombsText;
-		std::string leftLabel = "Bomb: " + bombsText;
-		int leftFont = 25;
-		int leftTextW = MeasureText(leftLabel.c_str(), leftFont);
-		int leftPadding = 25;
-		int leftBoxW = leftTextW + leftPadding * 2;
-		int leftBoxH = leftFont + leftPadding;
-		int leftX = 20;
-		int leftY = 15;
-		Rectangle leftBoxRect = { (float)leftX, (float)leftY, (float)leftBoxW, (float)leftBoxH };
-
-		int totalSeconds = (int)game.timer;
-		int minutes = totalSeconds / 60;
-		int seconds = totalSeconds % 60;
-		char timeBuf[8];
-		snprintf(timeBuf, sizeof(timeBuf), "%02d:%02d", minutes, seconds);
-		std::string rightLabel = std::string("Time: ") + timeBuf;
-		int rightFont = 25;
-		int rightTextW = MeasureText(rightLabel.c_str(), rightFont);
-		int rightPadding = 25;
-		int rightBoxW = rightTextW + rightPadding * 2;
-		int rightBoxH = rightFont + rightPadding;
-		int rightX = windowWidth - rightBoxW - 20;
-		int rightY = 15;
-		Rectangle rightBoxRect = { (float)rightX, (float)rightY, (float)rightBoxW, (float)rightBoxH };
-
-		if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
+		// Only does work when the window size or a displayed value changed.
+		hud.Layout(windowWidth, windowHeight);
+		if (state == AppState::Endless) hud.left.Update("Open: %d", (int)endless.revealedCnt);
+		else hud.left.Update("Bomb: %03d", game.flagsLeft);
+		int totalSeconds = (int)(state == AppState::Endless ? endless.clock.Seconds(updateStart) : game.clock.Seconds(updateStart));
+		hud.right.Update("Time: %02d:%02d", totalSeconds / 60, totalSeconds % 60);
+
+		// Wheel zooms around the cursor; arrow keys or Space + left drag pan.
+		bool panning = false;
+		if (state != AppState::Menu) {
+			const Game* bounds = state == AppState::Playing ? &game : nullptr;
 			Vector2 m = GetMousePosition();
+			if (CheckCollisionPointRec(m, renderer.viewport)) renderer.Zoom(bounds, GetMouseWheelMove(), m);
+			// Capped so the first step after an idle wait is not a jump.
+			float step = 600.0f * std::min(dt, 1.0f / 30.0f);
+			Vector2 pan = { 0.0f, 0.0f };
+			if (IsKeyDown(KEY_LEFT)) pan.x += step;
+			if (IsKeyDown(KEY_RIGHT)) pan.x -= step;
+			if (IsKeyDown(KEY_UP)) pan.y += step;
+			if (IsKeyDown(KEY_DOWN)) pan.y -= step;
+			panning = IsKeyDown(KEY_SPACE);
+			if (panning && IsMouseButtonDown(MOUSE_LEFT_BUTTON)) {
+				Vector2 d = GetMouseDelta();
+				pan.x += d.x; pan.y += d.y;
+			}
+			if (pan.x != 0.0f || pan.y != 0.0f) renderer.Pan(bounds, pan);
+		}
+
+		if (leftPressed && (!panning || injected)) {
+			Vector2 m = leftAt;
 			if (state == AppState::Menu) {
-				if (CheckCollisionPointRec(m, startBtn)) {
-					int newW = NORMAL_COLS * CELL_SIZE + MARGIN * 2;
-					int newH = NORMAL_ROWS * CELL_SIZE + MARGIN * 2 + 40;
+				if (hud.normal.Hit(m)) {
+					int newW, newH;
+					GridWindowSize(NORMAL_ROWS, NORMAL_COLS, newW, newH);
 					SetWindowSizeCentered(newW, newH);
 					windowWidth = newW; windowHeight = newH;
+					SetGridViewport(renderer, windowWidth, windowHeight);
 
 					game.Init(NORMAL_ROWS, NORMAL_COLS, NORMAL_MINES);
-					game.SetTextures(bombTex, bomb2Tex, questionTex, flagTex);
-					game.SetFaceTextures(face1, face2, face3, face4);
+					renderer.ResetCamera(game);
 					state = AppState::Playing;
 				}
-				else if (CheckCollisionPointRec(m, hardBtn)) {
-					int newW = HARD_COLS * CELL_SIZE + MARGIN * 2;
-					int newH = HARD_ROWS * CELL_SIZE + MARGIN * 2 + 40;
+				else if (hud.hard.Hit(m)) {
+					int newW, newH;
+					GridWindowSize(HARD_ROWS, HARD_COLS, newW, newH);
 					SetWindowSizeCentered(newW, newH);
 					windowWidth = newW; windowHeight = newH;
+					SetGridViewport(renderer, windowWidth, windowHeight);
 
 					game.Init(HARD_ROWS, HARD_COLS, HARD_MINES);
-					game.SetTextures(bombTex, bomb2Tex, questionTex, flagTex);
-					game.SetFaceTextures(face1, face2, face3, face4);
+					renderer.ResetCamera(game);
 					state = AppState::Playing;
 				}
-				else if (CheckCollisionPointRec(m, exitBtn)) {
+				else if (hud.endless.Hit(m)) {
+					int newW, newH;
+					GridWindowSize(HARD_ROWS, HARD_COLS, newW, newH);
+					SetWindowSizeCentered(newW, newH);
+					windowWidth = newW; windowHeight = newH;
+					SetGridViewport(renderer, windowWidth, windowHeight);
+
+					endless.Reset(RandomSeed(), ENDLESS_DENSITY);
+					renderer.CenterCamera(0, 0);
+					state = AppState::Endless;
+				}
+				else if (hud.exit.Hit(m)) {
 					break;
 				}
 			}
+			else if (state == AppState::Endless) {
+				if (endless.gameOver && CheckCollisionPointRec(m, hud.face)) {
+					endless.Reset(RandomSeed(), ENDLESS_DENSITY);
+					renderer.CenterCamera(0, 0);
+				}
+				else if (hud.OverHeader(m)) {
+					// do nothing
+				}
+				else {
+					long long row, col;
+					if (renderer.CellAt(m, row, col)) {
+						endless.HandleClick(row, col, true, inputAt);
+						endless.Evict(row, col, ENDLESS_KEEP_CHUNKS);
+					}
+				}
+			}
 			else { 
-				if ((game.gameOver || game.victory) && CheckCollisionPointRec(m, faceRect)) {
+				if ((game.gameOver || game.victory) && CheckCollisionPointRec(m, hud.face)) {
 					game.NewGame();
 				}
-				else if (CheckCollisionPointRec(m, leftBoxRect) || CheckCollisionPointRec(m, rightBoxRect) || CheckCollisionPointRec(m, faceRect)) {
+				else if (hud.OverHeader(m) || noGuessJob.Active()) {
 					// do nothing
 				}
 				else {
-					game.HandleClick(m, true, gridOffsetX, gridOffsetY);
+					int row, col;
+					if (renderer.CellAt(game, m, row, col)) {
+						if (noGuess && game.firstClick && game.grid.State(row, col) == CellState::Hidden) {
+							BoardSpec spec = { game.rows, game.cols, game.mineCount };
+							notice = Notice::None;
+							noticeSeed = game.GetSeed();
+							if (!NoGuessFeasible(spec)) notice = Notice::TooDense;
+							else if (boardPool->Take(spec, row, col, layout)) game.SetMines(layout);
+							else {
+								// Generated off the UI thread; the click is held until then.
+								noGuessJob.Start(spec, row, col, game.GetSeed(), NOGUESS_TRIES, NOGUESS_ROUNDS);
+								pendingRow = row;
+								pendingCol = col;
+								pendingSeed = game.GetSeed();
+								notice = Notice::Generating;
+							}
+						}
+						if (!noGuessJob.Active()) game.HandleClick(row, col, true, inputAt);
+					}
 				}
 			}
 		}
+		if (injected) latency.StateChanged(GameClock::Clock::now());
 
 		if (IsMouseButtonPressed(MOUSE_RIGHT_BUTTON)) {
 			Vector2 m = GetMousePosition();
 			if (state == AppState::Menu) {
 				// do nothing
 			}
+			else if (state == AppState::Endless) {
+				long long row, col;
+				if (!hud.OverHeader(m)
+					&& renderer.CellAt(m, row, col)) {
+					endless.HandleClick(row, col, false, inputAt);
+				}
+			}
 			else {
-				if (CheckCollisionPointRec(m, leftBoxRect) || CheckCollisionPointRec(m, rightBoxRect) || CheckCollisionPointRec(m, faceRect)) {
+				if (hud.OverHeader(m) || noGuessJob.Active()) {
 					// do nothing
 				}
 				else {
-					game.HandleClick(m, false, gridOffsetX, gridOffsetY);
+					int row, col;
+					if (renderer.CellAt(game, m, row, col)) game.HandleClick(row, col, false, inputAt);
 				}
 			}
 		}
 
-		BeginDrawing();
-		ClearBackground(Color{ 192,192,192 });
+		// Middle click chords, as does a left click on a revealed number.
+		if (IsMouseButtonPressed(MOUSE_MIDDLE_BUTTON) && state != AppState::Menu) {
+			Vector2 m = GetMousePosition();
+			if (hud.OverHeader(m)) {
+				// do nothing
+			}
+			else if (state == AppState::Endless) {
+				long long row, col;
+				if (renderer.CellAt(m, row, col)) {
+					endless.Chord(row, col);
+					if (endless.gameOver) endless.clock.Stop(inputAt);
+					endless.Evict(row, col, ENDLESS_KEEP_CHUNKS);
+				}
+			}
+			else {
+				int row, col;
+				if (renderer.CellAt(game, m, row, col) && game.grid.State(row, col) == CellState::Revealed) game.HandleClick(row, col, true, inputAt);
+			}
+		}
 
+		// A held first click gets its board once the pool or the job has one,
+		// at which point the clock starts. A new game or the menu drops it.
+		if (noGuessJob.Active()) {
+			if (state != AppState::Playing || !game.firstClick || game.GetSeed() != pendingSeed) noGuessJob.Cancel();
+			else {
+				BoardSpec spec = { game.rows, game.cols, game.mineCount };
+				bool verified = false, ready = false;
+				if (boardPool->Take(spec, pendingRow, pendingCol, layout)) {
+					noGuessJob.Cancel();
+					verified = ready = true;
+				}
+				else ready = noGuessJob.Poll(verified, layout);
+				if (ready) {
+					// A board that could not be verified is not passed off as
+					// one: the click places mines as usual.
+					if (verified) game.SetMines(layout);
+					notice = verified ? Notice::None : Notice::NotFound;
+					game.HandleClick(pendingRow, pendingCol, true, updateStart);
+				}
+			}
+		}
+
+		// Keep the last finished game for minesweeper-sim --replay.
+		if (state == AppState::Playing) {
+			bool over = game.gameOver || game.victory;
+			if (over && !replaySaved) game.log.Save("last_game.msr");
+			replaySaved = over;
+		}
+
+		// What the cursor is over: a menu button, or the face it makes.
+		int hover = 0;
+		int faceIndex = 0;
+		bool over = state == AppState::Endless ? endless.gameOver : game.gameOver;
 		if (state == AppState::Menu) {
-			DrawRectangle(0, 0, windowWidth, windowHeight, Color{ 100,149,237,255 });
-			const char* title = "MINESWEEPER";
-			int titleFont = 55;
-			int titleW = MeasureText(title, titleFont);
-			DrawText(title, windowWidth / 2 - titleW / 2, 80, titleFont, RAYWHITE);
-
-			Vector2 mousePos = GetMousePosition();
-			bool hoverStart = CheckCollisionPointRec(mousePos, startBtn);
-			bool hoverHard = CheckCollisionPointRec(mousePos, hardBtn);
-			bool hoverExit = CheckCollisionPointRec(mousePos, exitBtn);
-
-			DrawRectangleRec(startBtn, hoverStart ? Color{ 60,60,60,255 } : Color{ 40,40,40,255 });
-			DrawRectangleLines((int)startBtn.x, (int)startBtn.y, (int)startBtn.width, (int)startBtn.height, WHITE);
-			const char* startTxt = "Normal";
-			int sf = 28;
-			int sw = MeasureText(startTxt, sf);
-			DrawText(startTxt, (int)(startBtn.x + (startBtn.width - sw) / 2), (int)(startBtn.y + (startBtn.height - sf) / 2), sf, RAYWHITE);
-
-			DrawRectangleRec(hardBtn, hoverHard ? Color{ 60,60,60,255 } : Color{ 40,40,40,255 });
-			DrawRectangleLines((int)hardBtn.x, (int)hardBtn.y, (int)hardBtn.width, (int)hardBtn.height, WHITE);
-			const char* hardTxt = "Hard";
-			int hf = 28;
-			int hw = MeasureText(hardTxt, hf);
-			DrawText(hardTxt, (int)(hardBtn.x + (hardBtn.width - hw) / 2), (int)(hardBtn.y + (hardBtn.height - hf) / 2), hf, RAYWHITE);
-
-			DrawRectangleRec(exitBtn, hoverExit ? Color{ 60,60,60,255 } : Color{ 40,40,40,255 });
-			DrawRectangleLines((int)exitBtn.x, (int)exitBtn.y, (int)exitBtn.width, (int)exitBtn.height, WHITE);
-			const char* exitTxt = "Exit";
-			int ef = 28;
-			int ew = MeasureText(exitTxt, ef);
-			DrawText(exitTxt, (int)(exitBtn.x + (exitBtn.width - ew) / 2), (int)(exitBtn.y + (exitBtn.height - ef) / 2), ef, RAYWHITE);
-
-			const char* pre = "Press ";
-			const char* esc = "Esc";
-			const char* post = " to return to the menu";
-			const char* second = "while in the game";
-			int hintFont = 28;
-			int preW = MeasureText(pre, hintFont);
-			int escW = MeasureText(esc, hintFont);
-			int postW = MeasureText(post, hintFont);
-			int totalW = preW + escW + postW;
-			int line1Y = windowHeight - 80;
-			int hintX = windowWidth / 2 - totalW / 2;
-			DrawText(pre, hintX, line1Y, hintFont, WHITE);
-			DrawText(esc, hintX + preW, line1Y, hintFont, RED);
-			DrawText(post, hintX + preW + escW, line1Y, hintFont, WHITE);
-			int secondW = MeasureText(second, hintFont);
-			DrawText(second, windowWidth / 2 - secondW / 2, line1Y + hintFont + 6, hintFont, WHITE);
+			hover = hud.normal.Hit(mouse) ? 1 : hud.hard.Hit(mouse) ? 2 : hud.endless.Hit(mouse) ? 3 : hud.exit.Hit(mouse) ? 4 : 0;
 		}
 		else {
-			DrawRectangle(0, 0, windowWidth, 60, Color{ 128,128,128 });
+			if (state == AppState::Playing && game.victory) faceIndex = 3;
+			else if (over) faceIndex = 2;
+			else if (state == AppState::Endless) {
+				long long row, col;
+				if (renderer.CellAt(mouse, row, col)) {
+					if ((endless.Peek(row, col) & Grid::STATE_MASK) >> Grid::STATE_SHIFT == (int)CellState::Questioned) faceIndex = 1;
+				}
+			}
+			else {
+				int row, col;
+				if (renderer.CellAt(game, mouse, row, col)) {
+					if (game.grid.State(row, col) == CellState::Questioned) faceIndex = 1;
+				}
+			}
+			hover = 10 + faceIndex;
+		}
+
+		bool clockRunning = state == AppState::Playing ? !game.gameOver && !game.victory && !game.firstClick
+			: state == AppState::Endless && !endless.gameOver && endless.revealedCnt > 0;
+		bool live = continuous || showRenderStats || showProfiler || profiler.Tracing();
+		bool changed = !drawnOnce || input || hover != drawnHover || totalSeconds != drawnSeconds
+			|| (state == AppState::Playing && (game.allDirty || !game.dirtyCells.empty()));
+		// Sleeps until input only when nothing on screen is ticking. Synthetic
+		// clicks and a board being generated cannot wake an event wait, so
+		// they poll once a frame, as while the clock runs.
+		bool wait = !live && !clockRunning && !latency.Active() && !noGuessJob.Active();
+		if (wait != eventWaiting) {
+			if (wait) EnableEventWaiting();
+			else DisableEventWaiting();
+			eventWaiting = wait;
+		}
+		if (!live && !changed) {
+			if (!eventWaiting) WaitTime(1.0 / 60.0);
+			PollInputEvents();
+			continue;
+		}
+		drawnOnce = true;
+		drawnHover = hover;
+		drawnSeconds = totalSeconds;
+
+		Profiler::Clock::time_point drawStart = Profiler::Clock::now();
+		if (profiler.enabled) profiler.Record("update", updateStart, drawStart);
+		BeginDrawing();
+		ClearBackground(Color{ 192,192,192 });
 
-			DrawRectangle(leftX, leftY, leftBoxW, leftBoxH, BLACK);
-			DrawRectangleLines(leftX, leftY, leftBoxW, leftBoxH, WHITE);
-			DrawText(leftLabel.c_str(), leftX + leftPadding, leftY + (leftBoxH - leftFont) / 2, leftFont, RED);
+		if (state == AppState::Menu) hud.DrawMenu(mouse, noGuess, hasSave);
+		else {
+			hud.DrawHeader();
 
-			DrawRectangle(rightX, rightY, rightBoxW, rightBoxH, BLACK);
-			DrawRectangleLines(rightX, rightY, rightBoxW, rightBoxH, WHITE);
-			DrawText(rightLabel.c_str(), rightX + rightPadding, rightY + (rightBoxH - rightFont) / 2, rightFont, RED);
+			renderer.DrawFace(faceIndex, hud.face);
 
-			Rectangle faceDest = faceRect;
-			int faceIndex = 0;
-			if (game.victory) faceIndex = 3;
-			else if (game.gameOver) faceIndex = 2;
-			else {
-				Vector2 m = GetMousePosition();
-				int mx = (int)m.x - gridOffsetX;
-				int my = (int)m.y - gridOffsetY;
-				int col = mx / CELL_SIZE;
-				int row = my / CELL_SIZE;
-				if (mx >= 0 && my >= 0 && col >= 0 && col < game.GetCols() && row >= 0 && row < game.GetRows()) {
-					if (game.grid[row][col].state == CellState::Questioned) faceIndex = 1;
-				}
-				else faceIndex = 0;
+			{
+				ScopedTimer timer(&profiler, "DrawGrid");
+				if (state == AppState::Endless) renderer.DrawEndless(endless);
+				else renderer.DrawGrid(game);
 			}
-			Texture2D faceTex = game.faceTextures[faceIndex];
-			DrawTexturePro(faceTex, Rectangle{ 0.0f, 0.0f, (float)faceTex.width, (float)faceTex.height }, faceDest, Vector2{ 0.0f, 0.0f }, 0.0f, WHITE);
-
-			game.DrawGrid(gridOffsetX, gridOffsetY);
-
-			if (game.victory || game.gameOver) {
-				const char* msg = game.victory ? "YOU WIN!" : "GAME OVER!";
-				int fontSize = 40;
-				int textW = MeasureText(msg, fontSize);
-				int padding = 16;
-				int boxW = textW + padding * 2;
-				int boxH = fontSize + (int)(padding * 1.5f);
-				int boxX = windowWidth / 2 - boxW / 2;
-				int boxY = windowHeight - boxH - 7;
-				DrawRectangle(boxX, boxY, boxW, boxH, Color{ 0,0,0,200 });
-				DrawRectangleLines(boxX, boxY, boxW, boxH, WHITE);
-				DrawText(msg, boxX + padding, boxY + padding, fontSize, game.victory ? GREEN : RED);
+			if (profiler.enabled) {
+				profiler.Count("draw calls", renderer.stats.drawCalls);
+				profiler.Count("cells drawn", renderer.stats.cellsDrawn);
 			}
+			if (hintRow >= 0) renderer.DrawHint(hintRow, hintCol, hintMine);
+
+			bool won = state == AppState::Playing && game.victory;
+			if (won || over) hud.DrawResult(won);
+			else if (state == AppState::Playing && game.GetSeed() == noticeSeed) hud.DrawNotice(notice);
+
+			if (showRenderStats) {
+				DrawText(TextFormat("%s  grid draw calls: %d  cells: %d  frame: %.2f ms  heap allocs: %d", renderer.useCache ? "cached" : "direct",
+					renderer.stats.drawCalls, renderer.stats.cellsDrawn, GetFrameTime() * 1000.0f, (int)frameAllocations), 8, windowHeight - 20, 16, BLACK);
+			}
+		}
+
+		if (showProfiler) {
+			profiler.Summary(profile);
+			int lineH = 18;
+			int boxH = lineH * (int)(profile.size() + 2) + 8;
+			DrawRectangle(8, 68, 330, boxH, Color{ 0,0,0,190 });
+			int y = 72;
+			DrawText(TextFormat("frame  p50 %.2f ms  p99 %.2f ms", profiler.FramePercentile(0.50), profiler.FramePercentile(0.99)), 14, y, 16, RAYWHITE);
+			y += lineH;
+			for (const Profiler::ZoneStats& z : profile) {
+				if (z.counter) DrawText(TextFormat("%s  %.0f  (p99 %.0f)", z.name, z.last, z.p99), 14, y, 16, SKYBLUE);
+				else DrawText(TextFormat("%s  p50 %.3f  p99 %.3f ms", z.name, z.p50, z.p99), 14, y, 16, RAYWHITE);
+				y += lineH;
+			}
+			DrawText(profiler.Tracing() ? "recording trace, F4 to save" : "F4 to record a trace", 14, y, 16, profiler.Tracing() ? RED : GRAY);
 		}
 
+		Profiler::Clock::time_point presentStart = Profiler::Clock::now();
+		if (profiler.enabled) profiler.Record("draw", drawStart, presentStart);
 		EndDrawing();
+		if (profiler.enabled) profiler.Record("present", presentStart, Profiler::Clock::now());
+		if (!presented) {
+			TraceLog(LOG_INFO, "STARTUP: first frame after %.1f ms",
+				std::chrono::duration<double, std::milli>(Profiler::Clock::now() - launched).count());
+			presented = true;
+		}
+		// EndDrawing returns after raylib's frame pacing wait, so this is an
+		// upper bound on when the frame reached the screen.
+		if (latency.Active()) {
+			latency.Presented(Profiler::Clock::now());
+			if (latency.Done()) {
+				latency.Print(stdout);
+				break;
+			}
+		}
+		profiler.EndFrame();
+		// Operator new calls this frame; zero unless something changed.
+		frameAllocations = HeapAllocations() - allocationsBefore;
+		if (profiler.enabled) profiler.Count("heap allocs", (double)frameAllocations);
 	}
 
-	if (bombTex.id != 0) UnloadTexture(bombTex);
-	if (bomb2Tex.id != 0) UnloadTexture(bomb2Tex);
-	if (questionTex.id != 0) UnloadTexture(questionTex);
-	if (flagTex.id != 0) UnloadTexture(flagTex);
-	if (face1.id != 0) UnloadTexture(face1);
-	if (face2.id != 0) UnloadTexture(face2);
-	if (face3.id != 0) UnloadTexture(face3);
-	if (face4.id != 0) UnloadTexture(face4);
+	if (profiler.Tracing()) profiler.StopTrace(traceFile);
+
+	renderer.Unload();
 
 	CloseWindow();
 	return 0;
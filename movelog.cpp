@@ -0,0 +1,135 @@
+#include "movelog.h"
+#include <cstdio>
+#include <cstring>
+
+static const char MAGIC[4] = { 'M', 'S', 'R', 'P' };
+static const uint8_t VERSION = 1;
+static const uint8_t FLAG_LAYOUT = 1;
+
+static void PutVarint(std::vector<uint8_t>& out, uint64_t v) {
+    while (v >= 0x80) {
+        out.push_back((uint8_t)(v | 0x80));
+        v >>= 7;
+    }
+    out.push_back((uint8_t)v);
+}
+
+static bool GetVarint(const uint8_t* data, size_t size, size_t& pos, uint64_t& v) {
+    v = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (pos >= size) return false;
+        uint8_t b = data[pos++];
+        v |= (uint64_t)(b & 0x7F) << shift;
+        if (!(b & 0x80)) return true;
+    }
+    return false;
+}
+
+void MoveLog::Begin(int r, int c, int m, uint64_t s) {
+    rows = r;
+    cols = c;
+    mines = m;
+    seed = s;
+    hasLayout = false;
+    layout.Resize(0, 0);
+    moves.clear();
+    count = 0;
+}
+
+void MoveLog::SetLayout(const Bitboard& m) {
+    hasLayout = true;
+    layout = m;
+}
+
+void MoveLog::Append(int cell, MoveAction action) {
+    PutVarint(moves, ((uint64_t)cell << 2) | (uint64_t)action);
+    count++;
+}
+
+bool MoveLog::Next(size_t& pos, LoggedMove& move) const {
+    uint64_t v;
+    if (!GetVarint(moves.data(), moves.size(), pos, v)) return false;
+    move.cell = (int)(v >> 2);
+    move.action = (MoveAction)(v & 3);
+    return true;
+}
+
+void MoveLog::Serialize(std::vector<uint8_t>& out) const {
+    out.assign(MAGIC, MAGIC + 4);
+    out.push_back(VERSION);
+    PutVarint(out, (uint64_t)rows);
+    PutVarint(out, (uint64_t)cols);
+    PutVarint(out, (uint64_t)mines);
+    for (int i = 0; i < 8; i++) out.push_back((uint8_t)(seed >> (8 * i)));
+    out.push_back(hasLayout ? FLAG_LAYOUT : 0);
+    if (hasLayout) {
+        PutVarint(out, (uint64_t)layout.Count());
+        long long last = 0;
+        for (int r = 0; r < rows; r++) {
+            const uint64_t* words = layout.RowWords(r);
+            for (int w = 0; w < layout.WordsPerRow(); w++) {
+                for (uint64_t bits = words[w]; bits; bits &= bits - 1) {
+                    long long cell = (long long)r * cols + w * 64 + LowestBit(bits);
+                    PutVarint(out, (uint64_t)(cell - last));
+                    last = cell;
+                }
+            }
+        }
+    }
+    out.insert(out.end(), moves.begin(), moves.end());
+}
+
+bool MoveLog::Deserialize(const uint8_t* data, size_t size) {
+    if (size < 5 || memcmp(data, MAGIC, 4) != 0 || data[4] != VERSION) return false;
+    size_t pos = 5;
+    uint64_t r, c, m;
+    if (!GetVarint(data, size, pos, r) || !GetVarint(data, size, pos, c) || !GetVarint(data, size, pos, m)) return false;
+    if (r == 0 || c == 0 || r * c > (1ULL << 31) || m > r * c || pos + 9 > size) return false;
+    uint64_t s = 0;
+    for (int i = 0; i < 8; i++) s |= (uint64_t)data[pos++] << (8 * i);
+    uint8_t flags = data[pos++];
+    Begin((int)r, (int)c, (int)m, s);
+
+    if (flags & FLAG_LAYOUT) {
+        uint64_t n, delta;
+        if (!GetVarint(data, size, pos, n) || n > r * c) return false;
+        layout.Resize(rows, cols);
+        uint64_t cell = 0;
+        for (uint64_t i = 0; i < n; i++) {
+            if (!GetVarint(data, size, pos, delta)) return false;
+            cell += delta;
+            if (cell >= r * c) return false;
+            layout.Set((int)(cell / c), (int)(cell % c));
+        }
+        hasLayout = true;
+    }
+
+    moves.assign(data + pos, data + size);
+    LoggedMove move;
+    size_t p = 0;
+    while (Next(p, move)) {
+        if (move.cell < 0 || (uint64_t)move.cell >= r * c) return false;
+        count++;
+    }
+    return p == moves.size();
+}
+
+bool MoveLog::Save(const std::string& path) const {
+    std::vector<uint8_t> bytes;
+    Serialize(bytes);
+    FILE* f = fopen(path.c_str(), "wb");
+    if (!f) return false;
+    bool ok = fwrite(bytes.data(), 1, bytes.size(), f) == bytes.size();
+    return fclose(f) == 0 && ok;
+}
+
+bool MoveLog::Load(const std::string& path) {
+    FILE* f = fopen(path.c_str(), "rb");
+    if (!f) return false;
+    std::vector<uint8_t> bytes;
+    uint8_t buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) bytes.insert(bytes.end(), buf, buf + n);
+    fclose(f);
+    return Deserialize(bytes.data(), bytes.size());
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include "bitboard.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+enum class MoveAction : uint8_t {
+    Reveal, // left click
+    Mark,   // right click: hidden -> flagged -> questioned -> hidden
+    Undo,
+    Redo
+};
+
+struct LoggedMove {
+    int cell; // row * cols + col; 0 for Undo and Redo
+    MoveAction action;
+};
+
+// Append-only record of one game: the board parameters and seed, the mine
+// layout if it did not come from the seed (no-guess boards), and every move
+// that changed the board, undos included. Each move is one varint of
+// (cell << 2 | action), so most moves on boards up to 32x32 take two bytes.
+//
+// File format: "MSRP", version byte, varint rows, cols, mines, 8-byte
+// little-endian seed, flags byte (bit 0: explicit layout), then if flagged
+// a varint mine count and the mines' cell indices as varint deltas, then the
+// moves until the end of the file.
+class MoveLog {
+public:
+    int rows = 0;
+    int cols = 0;
+    int mines = 0;
+    uint64_t seed = 0;
+    bool hasLayout = false;
+    Bitboard layout;
+
+    void Begin(int rows, int cols, int mines, uint64_t seed);
+    void SetLayout(const Bitboard& mines);
+    void Append(int cell, MoveAction action);
+
+    size_t Moves() const { return count; }
+    const std::vector<uint8_t>& MoveBytes() const { return moves; }
+
+    // Decodes the move at byte offset pos and advances pos. False at the end.
+    bool Next(size_t& pos, LoggedMove& move) const;
+
+    void Serialize(std::vector<uint8_t>& out) const;
+    bool Deserialize(const uint8_t* data, size_t size);
+    bool Save(const std::string& path) const;
+    bool Load(const std::string& path);
+
+private:
+    std::vector<uint8_t> moves;
+    size_t count = 0;
+};
@@ -0,0 +1,195 @@
+#include "noguess.h"
+#include <utility>
+
+// Plays the current board from (row, col) with the Solver alone.
+bool NoGuessGenerator::Candidate(const BoardSpec& spec, uint64_t seed, int row, int col) {
+    if (game.rows != spec.rows || game.cols != spec.cols || game.mineCount != spec.mines) game.Init(spec.rows, spec.cols, spec.mines, seed);
+    else game.NewGame(seed);
+
+    game.HandleClick(row, col, true);
+    solver.Reset(game);
+    int r, c;
+    bool mine;
+    while (!game.victory && solver.Hint(game, r, c, mine)) {
+        if (cancel && cancel->load(std::memory_order_relaxed)) return false;
+        game.HandleClick(r, c, !mine);
+    }
+    return game.victory;
+}
+
+bool NoGuessGenerator::Try(const BoardSpec& spec, Xoshiro256& rng, SolvableBoard& out) {
+    int row = (int)rng.Below((uint64_t)spec.rows);
+    int col = (int)rng.Below((uint64_t)spec.cols);
+    if (!Candidate(spec, rng.Next(), row, col)) return false;
+
+    // The click cell has no mine in its 3x3 block, so it is a zero; every
+    // zero cell connected to it opens the same area.
+    const Grid& grid = game.grid;
+    const int* nb = grid.Neighbors();
+    out.spec = spec;
+    out.mines = game.mineBits;
+    out.starts.Resize(spec.rows, spec.cols);
+    int start = grid.Index(row, col);
+    out.starts.Set(row, col);
+    work.clear();
+    work.push_back(start);
+    while (!work.empty()) {
+        int idx = work.back();
+        work.pop_back();
+        for (int d = 0; d < 8; d++) {
+            int n = idx + nb[d];
+            int r = grid.RowOf(n), c = grid.ColOf(n);
+            if (r < 0 || r >= spec.rows || c < 0 || c >= spec.cols) continue;
+            if (grid.IsMine(n) || grid.Adjacent(n) != 0 || out.starts.Test(r, c)) continue;
+            out.starts.Set(r, c);
+            work.push_back(n);
+        }
+    }
+    return true;
+}
+
+bool NoGuessGenerator::GenerateAt(const BoardSpec& spec, int row, int col, Xoshiro256& rng, int maxTries, Bitboard& mines) {
+    bool solved = false;
+    for (int i = 0; i < maxTries && !solved; i++) {
+        if (cancel && cancel->load(std::memory_order_relaxed)) break;
+        solved = Candidate(spec, rng.Next(), row, col);
+    }
+    mines = game.mineBits;
+    return solved;
+}
+
+void NoGuessJob::Start(const BoardSpec& spec, int row, int col, uint64_t seed, int tries, int maxRounds) {
+    Cancel();
+    cancel = false;
+    done = false;
+    generator.cancel = &cancel;
+    thread = std::thread([this, spec, row, col, seed, tries, maxRounds] {
+        Xoshiro256 rng(seed);
+        bool ok = false;
+        for (int i = 0; i < maxRounds && !ok && !cancel; i++) ok = generator.GenerateAt(spec, row, col, rng, tries, result);
+        solved = ok;
+        done.store(true, std::memory_order_release);
+    });
+}
+
+void NoGuessJob::Cancel() {
+    if (!thread.joinable()) return;
+    cancel = true;
+    thread.join();
+}
+
+bool NoGuessJob::Poll(bool& verified, Bitboard& mines) {
+    if (!thread.joinable() || !done.load(std::memory_order_acquire)) return false;
+    thread.join();
+    verified = solved;
+    mines = result;
+    return true;
+}
+
+BoardPool::BoardPool(int threads, size_t d, uint64_t seed) : depth(d) {
+    if (threads <= 0) threads = (int)std::thread::hardware_concurrency() - 1;
+    if (threads < 1) threads = 1;
+    Xoshiro256 seeds(seed);
+    for (int i = 0; i < threads; i++) {
+        uint64_t s = seeds.Next();
+        workers.emplace_back([this, s] { Worker(s); });
+    }
+}
+
+BoardPool::~BoardPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stop = true;
+    }
+    wake.notify_all();
+    for (std::thread& t : workers) t.join();
+}
+
+BoardPool::Queue* BoardPool::Find(const BoardSpec& spec) {
+    for (Queue& q : queues) {
+        if (q.spec == spec) return &q;
+    }
+    return nullptr;
+}
+
+void BoardPool::Prefetch(const BoardSpec& spec) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (Find(spec)) return;
+        queues.emplace_back();
+        queues.back().spec = spec;
+    }
+    wake.notify_all();
+}
+
+size_t BoardPool::Ready(const BoardSpec& spec) {
+    std::lock_guard<std::mutex> lock(mutex);
+    Queue* q = Find(spec);
+    return q ? q->boards.size() : 0;
+}
+
+// Transform t maps a stored cell to the board: transpose if bit 2, then
+// flip rows if bit 1 and columns if bit 0.
+bool BoardPool::Take(const BoardSpec& spec, int row, int col, Bitboard& mines) {
+    std::unique_lock<std::mutex> lock(mutex);
+    Queue* q = Find(spec);
+    if (!q) return false;
+    int transforms = spec.rows == spec.cols ? 8 : 4;
+    for (auto it = q->boards.begin(); it != q->boards.end(); ++it) {
+        for (int t = 0; t < transforms; t++) {
+            int r = (t & 2) ? spec.rows - 1 - row : row;
+            int c = (t & 1) ? spec.cols - 1 - col : col;
+            if (t & 4) std::swap(r, c);
+            if (!it->starts.Test(r, c)) continue;
+
+            SolvableBoard board = std::move(*it);
+            q->boards.erase(it);
+            lock.unlock();
+            wake.notify_one();
+
+            mines.Resize(spec.rows, spec.cols);
+            for (int i = 0; i < spec.rows; i++) {
+                for (int j = 0; j < spec.cols; j++) {
+                    int sr = (t & 2) ? spec.rows - 1 - i : i;
+                    int sc = (t & 1) ? spec.cols - 1 - j : j;
+                    if (t & 4) std::swap(sr, sc);
+                    if (board.mines.Test(sr, sc)) mines.Set(i, j);
+                }
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+void BoardPool::Worker(uint64_t seed) {
+    Xoshiro256 rng(seed);
+    NoGuessGenerator generator;
+    generator.cancel = &stop;
+    SolvableBoard board;
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        // Round-robin over the queues that still have room.
+        Queue* q = nullptr;
+        for (size_t n = 0; n < queues.size() && !q; n++) {
+            Queue& cand = queues[(nextQueue + n) % queues.size()];
+            if (cand.boards.size() + cand.pending < depth) {
+                q = &cand;
+                nextQueue = (nextQueue + n + 1) % queues.size();
+            }
+        }
+        if (stop) return;
+        if (!q) {
+            wake.wait(lock);
+            continue;
+        }
+
+        q->pending++;
+        BoardSpec spec = q->spec;
+        lock.unlock();
+        bool ok = generator.Try(spec, rng, board);
+        lock.lock();
+        q->pending--;
+        if (ok) q->boards.push_back(std::move(board));
+    }
+}
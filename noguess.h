@@ -0,0 +1,128 @@
+#pragma once
+#include "bitboard.h"
+#include "game.h"
+#include "solver.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct BoardSpec {
+    int rows;
+    int cols;
+    int mines;
+
+    bool operator==(const BoardSpec& o) const { return rows == o.rows && cols == o.cols && mines == o.mines; }
+};
+
+// Verified boards get rare quickly as the density rises: about one
+// candidate in ten passes at 9x9/20 or 16x30/99, one in five hundred at
+// 16x30/120, and next to none at 30%. Denser boards are refused rather
+// than searched for.
+const int NOGUESS_MAX_DENSITY_PERCENT = 25;
+
+inline bool NoGuessFeasible(const BoardSpec& spec) {
+    return (long long)spec.mines * 100 <= (long long)spec.rows * spec.cols * NOGUESS_MAX_DENSITY_PERCENT;
+}
+
+// A mine layout the Solver clears without guessing when the first click
+// lands on any cell of `starts`: the zero cells of the opening it was
+// verified from, all of which reveal the same area.
+struct SolvableBoard {
+    BoardSpec spec;
+    Bitboard mines;
+    Bitboard starts;
+};
+
+// Rejection sampling for boards that need no guessing: draw a layout, play
+// it with the Solver from the first click, keep it only if the Solver wins.
+// The Solver uses local rules only, so every accepted board is guess-free
+// but not every guess-free board is accepted. One generator per thread.
+class NoGuessGenerator {
+public:
+    // Checked between solver moves; when it reads true the candidate is
+    // abandoned, so a pool can shut down without waiting on a huge board.
+    const std::atomic<bool>* cancel = nullptr;
+
+    // One candidate with the click at a random cell. False if it needed a guess.
+    bool Try(const BoardSpec& spec, Xoshiro256& rng, SolvableBoard& out);
+    // Up to maxTries candidates with the first click at (row, col). Returns
+    // false, leaving the last candidate in mines, if every one needed a guess
+    // or cancel was set.
+    bool GenerateAt(const BoardSpec& spec, int row, int col, Xoshiro256& rng, int maxTries, Bitboard& mines);
+
+private:
+    bool Candidate(const BoardSpec& spec, uint64_t seed, int row, int col);
+
+    Game game;
+    Solver solver;
+    std::vector<int> work;
+};
+
+// Generates the board for one first click on its own thread, for when no
+// ready board fits it, so the click handler returns at once and frames keep
+// coming while the rejection loop runs. Gives up after maxRounds rounds of
+// `tries` candidates.
+class NoGuessJob {
+public:
+    ~NoGuessJob() { Cancel(); }
+
+    // Cancels any job still running first.
+    void Start(const BoardSpec& spec, int row, int col, uint64_t seed, int tries, int maxRounds);
+    // Abandons the board being generated and waits for the thread.
+    void Cancel();
+    bool Active() const { return thread.joinable(); }
+    // True once the job has finished, after which it is no longer active;
+    // verified tells whether mines holds a board that needs no guessing.
+    bool Poll(bool& verified, Bitboard& mines);
+
+private:
+    NoGuessGenerator generator;
+    std::thread thread;
+    std::atomic<bool> cancel{ false };
+    std::atomic<bool> done{ false };
+    bool solved = false;
+    Bitboard result;
+};
+
+// Generates no-guess boards ahead of time on worker threads, so the first
+// click of a game does not wait for the rejection loop. Each board size
+// registered with Prefetch gets its own queue of at most `depth` ready
+// boards; workers sleep while every queue is full.
+//
+// A ready board was verified from one opening, but the click can land
+// anywhere. Take matches the click against each board under the board's
+// symmetries (flips, and transposes on square boards), which the Solver's
+// rules do not see, and returns the first layout that fits.
+class BoardPool {
+public:
+    // threads <= 0 uses one less than the number of cores (at least one).
+    BoardPool(int threads = 0, size_t depth = 4, uint64_t seed = RandomSeed());
+    ~BoardPool();
+
+    void Prefetch(const BoardSpec& spec);
+    // Takes a ready board whose opening contains (row, col), transformed to
+    // put it there. False if none fits; the caller then generates in place.
+    bool Take(const BoardSpec& spec, int row, int col, Bitboard& mines);
+    size_t Ready(const BoardSpec& spec);
+
+private:
+    struct Queue {
+        BoardSpec spec;
+        std::deque<SolvableBoard> boards;
+        size_t pending = 0; // boards being generated for this queue
+    };
+
+    void Worker(uint64_t seed);
+    Queue* Find(const BoardSpec& spec);
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::deque<Queue> queues;
+    size_t depth;
+    size_t nextQueue = 0;
+    std::atomic<bool> stop{ false };
+    std::vector<std::thread> workers;
+};
@@ -0,0 +1,294 @@
+#include "probability.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+void AddShifted(std::vector<double>& dst, const std::vector<double>& src, int shift) {
+    if (dst.size() < src.size() + shift) dst.resize(src.size() + shift, 0.0);
+    for (size_t k = 0; k < src.size(); k++) dst[k + shift] += src[k];
+}
+
+void AddConvolved(std::vector<double>& dst, const std::vector<double>& a, const std::vector<double>& b, int shift) {
+    if (a.empty() || b.empty()) return;
+    if (dst.size() < a.size() + b.size() - 1 + shift) dst.resize(a.size() + b.size() - 1 + shift, 0.0);
+    for (size_t i = 0; i < a.size(); i++) {
+        if (a[i] == 0.0) continue;
+        for (size_t j = 0; j < b.size(); j++) dst[i + j + shift] += a[i] * b[j];
+    }
+}
+
+// Weights are only ever compared within one component or one product, so
+// each can be rescaled freely; this keeps products of large boards finite.
+double Normalize(std::vector<double>& p) {
+    double m = 0.0;
+    for (double x : p) m = std::max(m, x);
+    if (m > 0.0) for (double& x : p) x /= m;
+    return m;
+}
+
+double LogChoose(int n, int k) {
+    if (k < 0 || k > n) return -INFINITY;
+    return std::lgamma(n + 1.0) - std::lgamma(k + 1.0) - std::lgamma(n - k + 1.0);
+}
+
+}
+
+bool ProbabilityEngine::Compute(const Game& game) {
+    const Grid& grid = game.grid;
+    const int* nb = grid.Neighbors();
+    size_t size = (size_t)grid.PaddedSize();
+    prob.assign(size, -1.0f);
+    localId.assign(size, -1);
+    conId.assign(size, -1);
+    components = frontierCells = 0;
+
+    // Numbers with a hidden neighbor are constraints (conId -2 until their
+    // component claims them); their hidden neighbors are the frontier
+    // (localId -2 until a component is built from them).
+    int hidden = 0;
+    for (int r = 0; r < game.rows; r++) {
+        int idx = grid.Index(r, 0);
+        for (int c = 0; c < game.cols; c++, idx++) {
+            if (grid.State(idx) != CellState::Revealed) { hidden++; continue; }
+            if (grid.IsMine(idx) || grid.Adjacent(idx) == 0) continue;
+            for (int d = 0; d < 8; d++) {
+                int n = idx + nb[d];
+                if (grid.State(n) == CellState::Revealed) continue;
+                conId[idx] = -2;
+                if (localId[n] == -1) { localId[n] = -2; frontierCells++; }
+            }
+        }
+    }
+    interiorCells = hidden - frontierCells;
+
+    std::vector<std::vector<int>> compCells;
+    std::vector<Poly> totals;
+    std::vector<std::vector<Poly>> perCell;
+    bool ok = true;
+    int unsolved = 0;
+    std::vector<int> cells;
+    for (int r = 0; r < game.rows; r++) {
+        int idx = grid.Index(r, 0);
+        for (int c = 0; c < game.cols; c++, idx++) {
+            if (localId[idx] != -2) continue;
+            // BFS order keeps each number's cells close together, so few
+            // constraints are open at any step of the enumeration.
+            cells.clear();
+            localId[idx] = 0;
+            cells.push_back(idx);
+            for (size_t q = 0; q < cells.size(); q++) {
+                for (int d = 0; d < 8; d++) {
+                    int con = cells[q] + nb[d];
+                    if (conId[con] == -1) continue;
+                    for (int e = 0; e < 8; e++) {
+                        int n = con + nb[e];
+                        if (localId[n] != -2) continue;
+                        localId[n] = (int)cells.size();
+                        cells.push_back(n);
+                    }
+                }
+            }
+            components++;
+            Poly total;
+            std::vector<Poly> weights;
+            Result result = SolveComponent(grid, cells, total, weights);
+            if (result == Result::Inconsistent) return false;
+            if (result == Result::TooWide) {
+                // Left unsolved; its cells are counted as unconstrained.
+                ok = false;
+                unsolved += (int)cells.size();
+                continue;
+            }
+            compCells.push_back(cells);
+            totals.push_back(std::move(total));
+            perCell.push_back(std::move(weights));
+        }
+    }
+
+    // w[K]: ways to place the remaining mines in the interior when the
+    // frontier holds K of them.
+    int M = game.mineCount;
+    int I = interiorCells + unsolved;
+    int maxK = frontierCells - unsolved;
+    std::vector<double> logW(maxK + 1), w(maxK + 1);
+    double top = -INFINITY;
+    for (int k = 0; k <= maxK; k++) top = std::max(top, logW[k] = LogChoose(I, M - k));
+    if (top == -INFINITY) return false;
+    for (int k = 0; k <= maxK; k++) w[k] = std::exp(logW[k] - top);
+
+    size_t C = totals.size();
+    std::vector<Poly> prefix(C + 1), suffix(C + 1);
+    prefix[0] = Poly{ 1.0 };
+    suffix[C] = Poly{ 1.0 };
+    for (size_t c = 0; c < C; c++) {
+        AddConvolved(prefix[c + 1], prefix[c], totals[c], 0);
+        Normalize(prefix[c + 1]);
+    }
+    for (size_t c = C; c-- > 0;) {
+        AddConvolved(suffix[c], suffix[c + 1], totals[c], 0);
+        Normalize(suffix[c]);
+    }
+
+    Poly others, g;
+    for (size_t c = 0; c < C; c++) {
+        others.clear();
+        AddConvolved(others, prefix[c], suffix[c + 1], 0);
+        const Poly& t = totals[c];
+        g.assign(t.size(), 0.0);
+        for (size_t kc = 0; kc < t.size(); kc++) {
+            for (size_t k = 0; k < others.size() && kc + k <= (size_t)maxK; k++) g[kc] += others[k] * w[kc + k];
+        }
+        double z = 0.0;
+        for (size_t kc = 0; kc < t.size(); kc++) z += t[kc] * g[kc];
+        if (z <= 0.0) return false;
+        for (size_t i = 0; i < compCells[c].size(); i++) {
+            const Poly& wc = perCell[c][i];
+            double p = 0.0;
+            for (size_t kc = 0; kc < wc.size(); kc++) p += wc[kc] * g[kc];
+            prob[compCells[c][i]] = (float)(p / z);
+        }
+    }
+
+    if (interiorCells > 0) {
+        const Poly& all = prefix[C];
+        double num = 0.0, z = 0.0;
+        for (size_t k = 0; k < all.size() && k <= (size_t)maxK; k++) {
+            z += all[k] * w[k];
+            num += all[k] * w[k] * (M - (int)k);
+        }
+        if (z <= 0.0) return false;
+        float p = (float)(num / z / I);
+        for (int r = 0; r < game.rows; r++) {
+            int idx = grid.Index(r, 0);
+            for (int c = 0; c < game.cols; c++, idx++) {
+                if (localId[idx] == -1 && grid.State(idx) != CellState::Revealed) prob[idx] = p;
+            }
+        }
+    }
+    return ok;
+}
+
+bool ProbabilityEngine::Step(const std::string& state, int i, int v, std::string& next) const {
+    for (const Slot& s : closing[i]) {
+        int left = (s.src >= 0 ? state[s.src] : cons[s.con].need) - (s.hasCell ? v : 0);
+        if (left != 0) return false;
+    }
+    next.clear();
+    for (const Slot& s : slots[i]) {
+        int left = (s.src >= 0 ? state[s.src] : cons[s.con].need) - (s.hasCell ? v : 0);
+        if (left < 0 || left > s.left) return false;
+        next.push_back((char)left);
+    }
+    return true;
+}
+
+ProbabilityEngine::Result ProbabilityEngine::SolveComponent(const Grid& grid, const std::vector<int>& cells, Poly& total, std::vector<Poly>& perCell) {
+    const int* nb = grid.Neighbors();
+    int n = (int)cells.size();
+
+    // The component's numbers, each with its cells as ascending local ids.
+    cons.clear();
+    std::vector<std::vector<int>> startsAt(n);
+    for (int i = 0; i < n; i++) {
+        for (int d = 0; d < 8; d++) {
+            int c = cells[i] + nb[d];
+            if (conId[c] != -2) continue;
+            conId[c] = (int)cons.size();
+            Constraint con;
+            con.need = grid.Adjacent(c);
+            for (int e = 0; e < 8; e++) {
+                int x = c + nb[e];
+                if (localId[x] >= 0) con.cells.push_back(localId[x]);
+            }
+            std::sort(con.cells.begin(), con.cells.end());
+            startsAt[con.cells.front()].push_back((int)cons.size());
+            cons.push_back(std::move(con));
+        }
+    }
+
+    // Lay out the state after each step: the open constraints' remaining
+    // mine counts, in a fixed slot order.
+    slots.assign(n, std::vector<Slot>());
+    closing.assign(n, std::vector<Slot>());
+    std::vector<int> open, nextOpen;
+    for (int i = 0; i < n; i++) {
+        nextOpen.clear();
+        int slotCount = (int)open.size();
+        for (int j = 0; j < slotCount + (int)startsAt[i].size(); j++) {
+            int con = j < slotCount ? open[j] : startsAt[i][j - slotCount];
+            const std::vector<int>& cc = cons[con].cells;
+            Slot s;
+            s.con = con;
+            s.src = j < slotCount ? j : -1;
+            s.hasCell = std::binary_search(cc.begin(), cc.end(), i);
+            s.left = (int)(cc.end() - std::upper_bound(cc.begin(), cc.end(), i));
+            if (cc.back() == i) closing[i].push_back(s);
+            else {
+                slots[i].push_back(s);
+                nextOpen.push_back(con);
+            }
+        }
+        open.swap(nextOpen);
+    }
+
+    if ((int)forward.size() < n + 1) {
+        forward.resize(n + 1);
+        backward.resize(n + 1);
+    }
+    for (int i = 0; i <= n; i++) {
+        forward[i].clear();
+        backward[i].clear();
+    }
+
+    std::string next;
+    forward[0][std::string()] = Poly{ 1.0 };
+    // Roughly what a memo entry costs besides its weights, in doubles.
+    const size_t ENTRY_OVERHEAD = 8;
+    size_t stored = 0;
+    for (int i = 0; i < n; i++) {
+        for (const auto& entry : forward[i]) {
+            for (int v = 0; v <= 1; v++) {
+                if (Step(entry.first, i, v, next)) AddShifted(forward[i + 1][next], entry.second, v);
+            }
+        }
+        if (forward[i + 1].empty()) return Result::Inconsistent;
+        if (forward[i + 1].size() > maxStates) return Result::TooWide;
+        for (const auto& entry : forward[i + 1]) stored += entry.second.size() + ENTRY_OVERHEAD;
+        if (stored > maxWeights) return Result::TooWide;
+    }
+
+    perCell.assign(n, Poly());
+    backward[n][std::string()] = Poly{ 1.0 };
+    for (int i = n - 1; i >= 0; i--) {
+        for (const auto& entry : forward[i]) {
+            for (int v = 0; v <= 1; v++) {
+                if (!Step(entry.first, i, v, next)) continue;
+                auto it = backward[i + 1].find(next);
+                if (it == backward[i + 1].end()) continue;
+                AddShifted(backward[i][entry.first], it->second, v);
+                if (v) AddConvolved(perCell[i], entry.second, it->second, 1);
+            }
+        }
+    }
+
+    total = forward[n][std::string()];
+    double scale = Normalize(total);
+    for (Poly& p : perCell) for (double& x : p) x /= scale;
+    return Result::Solved;
+}
+
+bool ProbabilityEngine::BestGuess(const Game& game, int& row, int& col) const {
+    const Grid& grid = game.grid;
+    float best = 2.0f;
+    for (int r = 0; r < game.rows; r++) {
+        int idx = grid.Index(r, 0);
+        for (int c = 0; c < game.cols; c++, idx++) {
+            if (grid.State(idx) != CellState::Hidden || prob[idx] < 0.0f || prob[idx] >= best) continue;
+            best = prob[idx];
+            row = r;
+            col = c;
+        }
+    }
+    return best <= 1.0f;
+}
@@ -0,0 +1,81 @@
+#pragma once
+#include "game.h"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Exact mine probability of every hidden cell given the revealed numbers and
+// the total mine count.
+//
+// Hidden cells next to a revealed number form the frontier; the frontier is
+// split into components that share no number. Each component is enumerated
+// by backtracking in BFS order, memoized on the remaining mine counts of the
+// numbers that are partly assigned: partial assignments that leave the same
+// counts behind have the same completions, so the search is a dynamic
+// program whose width is the number of open constraints, not 2^cells. A
+// forward and a backward pass give, for every mine total k, the number of
+// valid configurations and how many of them put a mine on each cell.
+// Components and the interior (hidden cells next to no number) are then
+// combined: a choice of k mines on the frontier leaves C(interior, M - k)
+// ways for the rest. Like the Solver, player flags are not trusted.
+class ProbabilityEngine {
+public:
+    // A component whose memo grows past this many states at any step is
+    // given up on and its cells are left without a probability.
+    size_t maxStates = 1 << 16;
+    // Likewise for the memo as a whole: the states of all steps together
+    // with their weights, counted in doubles. Long components on large
+    // boards hit this before maxStates.
+    size_t maxWeights = 1 << 24;
+
+    // Returns false if the board has no consistent configuration or some
+    // component was too large; cells that could be solved are still set.
+    bool Compute(const Game& game);
+
+    // Mine probability of the cell at padded index idx, or -1 for cells
+    // that are revealed or were not solved.
+    float Probability(int idx) const { return prob[idx]; }
+    const std::vector<float>& Probabilities() const { return prob; }
+    // The hidden cell without a flag or question mark that is least likely
+    // to be a mine.
+    bool BestGuess(const Game& game, int& row, int& col) const;
+
+    int Components() const { return components; }
+    int FrontierCells() const { return frontierCells; }
+    int InteriorCells() const { return interiorCells; }
+
+private:
+    typedef std::vector<double> Poly; // Poly[k]: weight of k mines
+    typedef std::unordered_map<std::string, Poly> Layer;
+
+    struct Constraint {
+        std::vector<int> cells; // local ids, ascending
+        int need = 0;
+    };
+    // Per-step transition: where each slot of the next state comes from.
+    struct Slot {
+        int con;
+        int src;      // slot in the current state, or -1 if con starts here
+        bool hasCell; // the cell assigned at this step belongs to con
+        int left;     // cells of con still unassigned after this step
+    };
+
+    enum class Result { Solved, TooWide, Inconsistent };
+    Result SolveComponent(const Grid& grid, const std::vector<int>& cells, Poly& total, std::vector<Poly>& perCell);
+    bool Step(const std::string& state, int i, int v, std::string& next) const;
+
+    std::vector<float> prob;
+    int components = 0;
+    int frontierCells = 0;
+    int interiorCells = 0;
+
+    // Scratch kept between calls.
+    std::vector<int> localId;
+    std::vector<int> conId;
+    std::vector<Constraint> cons;
+    std::vector<std::vector<Slot>> slots;  // slots[i]: next state after cell i
+    std::vector<std::vector<Slot>> closing; // constraints whose last cell is i
+    std::vector<Layer> forward;
+    std::vector<Layer> backward;
+};
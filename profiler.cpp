@@ -0,0 +1,115 @@
+#include "profiler.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+static double Millis(Profiler::Clock::duration d) {
+    return std::chrono::duration<double, std::milli>(d).count();
+}
+
+// p-th percentile of the last min(count, n) values of a ring of n.
+static double RingPercentile(const double* ring, int n, int count, double p) {
+    int kept = std::min(count, n);
+    if (kept == 0) return 0.0;
+    double sorted[Profiler::HISTORY];
+    std::copy(ring, ring + kept, sorted);
+    int k = std::min(kept - 1, (int)(p * (kept - 1) + 0.5));
+    std::nth_element(sorted, sorted + k, sorted + kept);
+    return sorted[k];
+}
+
+Profiler::Zone& Profiler::Find(const char* name, bool counter) {
+    for (Zone& z : zones) {
+        if (z.name == name) return z;
+    }
+    for (Zone& z : zones) {
+        if (strcmp(z.name, name) == 0) return z;
+    }
+    zones.emplace_back();
+    zones.back().name = name;
+    zones.back().counter = counter;
+    return zones.back();
+}
+
+void Profiler::BeginFrame() {
+    frameStart = Clock::now();
+    inFrame = true;
+}
+
+void Profiler::EndFrame() {
+    if (!inFrame) return;
+    inFrame = false;
+    Clock::time_point end = Clock::now();
+    frames[frameCount % HISTORY] = Millis(end - frameStart);
+    frameCount++;
+    if (tracing) Trace("frame", frameStart, (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - frameStart).count(), false);
+    for (Zone& z : zones) {
+        if (!z.active) continue;
+        z.history[z.count % HISTORY] = z.current;
+        z.count++;
+        z.active = false;
+        z.current = 0.0;
+    }
+}
+
+void Profiler::Record(const char* name, Clock::time_point start, Clock::time_point end) {
+    Zone& z = Find(name, false);
+    z.current += Millis(end - start);
+    z.active = true;
+    if (tracing) Trace(name, start, (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count(), false);
+}
+
+void Profiler::Count(const char* name, double value) {
+    Zone& z = Find(name, true);
+    z.current = value;
+    z.active = true;
+    if (tracing) Trace(name, Clock::now(), value, true);
+}
+
+double Profiler::FramePercentile(double p) const {
+    return RingPercentile(frames, HISTORY, frameCount, p);
+}
+
+void Profiler::Summary(std::vector<ZoneStats>& out) const {
+    out.clear();
+    for (const Zone& z : zones) {
+        double last = z.count > 0 ? z.history[(z.count - 1) % HISTORY] : 0.0;
+        out.push_back({ z.name, z.counter, last, RingPercentile(z.history, HISTORY, z.count, 0.50), RingPercentile(z.history, HISTORY, z.count, 0.99) });
+    }
+}
+
+void Profiler::StartTrace(size_t limit) {
+    events.clear();
+    events.reserve(std::min(limit, (size_t)1 << 16));
+    maxEvents = limit;
+    traceStart = Clock::now();
+    tracing = true;
+    enabled = true;
+}
+
+void Profiler::Trace(const char* name, Clock::time_point start, double value, bool counter) {
+    if (events.size() >= maxEvents) return;
+    int64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(start - traceStart).count();
+    events.push_back({ name, ns, value, counter });
+}
+
+// Complete ("X") events for spans and "C" events for counters, timestamps in
+// microseconds. Viewers nest spans on the same thread by their times.
+bool Profiler::StopTrace(const std::string& path) {
+    tracing = false;
+    FILE* f = fopen(path.c_str(), "w");
+    if (!f) return false;
+    fprintf(f, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    for (size_t i = 0; i < events.size(); i++) {
+        const Event& e = events[i];
+        const char* sep = i + 1 < events.size() ? "," : "";
+        if (e.counter)
+            fprintf(f, "{\"name\":\"%s\",\"ph\":\"C\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"args\":{\"value\":%g}}%s\n", e.name, e.start / 1000.0, e.value, sep);
+        else
+            fprintf(f, "{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f}%s\n", e.name, e.start / 1000.0, e.value / 1000.0, sep);
+    }
+    fprintf(f, "]}\n");
+    events.clear();
+    events.shrink_to_fit();
+    return fclose(f) == 0;
+}
@@ -0,0 +1,98 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Frame profiler for the game loop. Named zones are timed with ScopedTimer
+// (or Record for spans that are not a C++ scope); each zone keeps its total
+// per frame for the last HISTORY frames it ran in, from which the overlay
+// reads p50 and p99. Counters such as draw calls keep their last value per
+// frame the same way. While a trace is recording, every span and counter is
+// also kept as an event and written out as Chrome trace-event JSON
+// (chrome://tracing, Perfetto).
+//
+// Zone names are compared by pointer first, so pass string literals. Not
+// thread-safe: one profiler per thread.
+class Profiler {
+public:
+    typedef std::chrono::steady_clock Clock;
+    static const int HISTORY = 240;
+
+    struct ZoneStats {
+        const char* name;
+        bool counter;
+        double last;
+        double p50;
+        double p99;
+    };
+
+    // Off by default; a disabled profiler costs a ScopedTimer one branch.
+    bool enabled = false;
+
+    void BeginFrame();
+    void EndFrame();
+    void Record(const char* name, Clock::time_point start, Clock::time_point end);
+    void Count(const char* name, double value);
+
+    // Frame times (ms) over the kept frames.
+    double FramePercentile(double p) const;
+    // One entry per zone and counter in first-seen order; times in ms.
+    // Zones that have not run for a while keep their old figures.
+    void Summary(std::vector<ZoneStats>& out) const;
+
+    // Events past maxEvents are dropped, so a forgotten trace cannot eat memory.
+    void StartTrace(size_t maxEvents = 1 << 22);
+    bool StopTrace(const std::string& path);
+    bool Tracing() const { return tracing; }
+
+private:
+    struct Zone {
+        const char* name;
+        bool counter;
+        bool active = false; // recorded since the last EndFrame
+        double current = 0.0;
+        int count = 0; // frames recorded, including those dropped from history
+        double history[HISTORY] = { 0.0 };
+    };
+
+    struct Event {
+        const char* name;
+        int64_t start; // ns since the trace started
+        double value; // duration in ns, or the counter's value
+        bool counter;
+    };
+
+    Zone& Find(const char* name, bool counter);
+    void Trace(const char* name, Clock::time_point start, double value, bool counter);
+
+    std::vector<Zone> zones;
+    double frames[HISTORY] = { 0.0 };
+    int frameCount = 0; // frames ended, including those dropped from history
+    Clock::time_point frameStart;
+    bool inFrame = false;
+
+    bool tracing = false;
+    size_t maxEvents = 0;
+    Clock::time_point traceStart;
+    std::vector<Event> events;
+};
+
+class ScopedTimer {
+public:
+    ScopedTimer(Profiler* profiler, const char* name)
+        : profiler(profiler && profiler->enabled ? profiler : nullptr), name(name) {
+        if (this->profiler) start = Profiler::Clock::now();
+    }
+    ~ScopedTimer() {
+        if (profiler) profiler->Record(name, start, Profiler::Clock::now());
+    }
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    Profiler* profiler;
+    const char* name;
+    Profiler::Clock::time_point start;
+};
@@ -0,0 +1,356 @@
+#include "renderer.h"
+#include <cmath>
+
+// Largest board, in pixels per side, that is drawn through the cache texture.
+static const int MAX_CACHE_PX = 4096;
+
+// The pixels are already decoded and in GPU order, so this is a single
+// upload straight from the binary's read-only data.
+void GameRenderer::LoadSprites() {
+    if (sprites.id != 0) return;
+    Image image = { (void*)ATLAS_PIXELS, ATLAS_WIDTH, ATLAS_HEIGHT, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+    sprites = LoadTextureFromImage(image);
+}
+
+void GameRenderer::Unload() {
+    if (sprites.id != 0) UnloadTexture(sprites);
+    if (atlas.id != 0) UnloadRenderTexture(atlas);
+    if (cache.id != 0) UnloadRenderTexture(cache);
+    sprites = Texture2D{ 0 };
+    atlas = RenderTexture2D{ 0 };
+    cache = RenderTexture2D{ 0 };
+    cacheRows = cacheCols = 0;
+}
+
+static Rectangle SpriteSource(int sprite) {
+    const SpriteRect& r = SPRITES[sprite];
+    return Rectangle{ (float)r.x, (float)r.y, (float)r.width, (float)r.height };
+}
+
+void GameRenderer::DrawFace(int face, Rectangle dest) {
+    DrawTexturePro(sprites, SpriteSource(SPRITE_FACE + face), dest, Vector2{ 0.0f, 0.0f }, 0.0f, WHITE);
+}
+
+void GameRenderer::SetViewport(int x, int y, int width, int height) {
+    viewport = Rectangle{ (float)x, (float)y, (float)width, (float)height };
+}
+
+static float MinZoom(const Game& game, const Rectangle& viewport) {
+    float fit = fminf(viewport.width / (float)(game.cols * CELL_SIZE), viewport.height / (float)(game.rows * CELL_SIZE));
+    // Below a few pixels per cell the number of visible cells, and with it
+    // the cost of the uncached path, would grow without bound.
+    float floor = 4.0f / (float)CELL_SIZE;
+    return fminf(1.0f, fmaxf(fit, floor));
+}
+
+void GameRenderer::ResetCamera(const Game& game) {
+    camera.rotation = 0.0f;
+    camera.zoom = 1.0f;
+    camera.offset = Vector2{ viewport.x, viewport.y };
+    camera.target = Vector2{ 0.0f, 0.0f };
+    ClampCamera(game);
+}
+
+void GameRenderer::CenterCamera(long long row, long long col) {
+    camera.rotation = 0.0f;
+    camera.zoom = 1.0f;
+    camera.offset = Vector2{ viewport.x + viewport.width * 0.5f, viewport.y + viewport.height * 0.5f };
+    camera.target = Vector2{ ((float)col + 0.5f) * CELL_SIZE, ((float)row + 0.5f) * CELL_SIZE };
+}
+
+void GameRenderer::Zoom(const Game* game, float wheel, Vector2 anchor) {
+    if (wheel == 0.0f) return;
+    camera.target = GetScreenToWorld2D(anchor, camera);
+    camera.offset = anchor;
+    camera.zoom *= wheel > 0.0f ? 1.25f : 0.8f;
+    float minZoom = game ? MinZoom(*game, viewport) : 8.0f / CELL_SIZE;
+    camera.zoom = fmaxf(minZoom, fminf(camera.zoom, 4.0f));
+    if (game) ClampCamera(*game);
+}
+
+void GameRenderer::Pan(const Game* game, Vector2 screenDelta) {
+    camera.target.x -= screenDelta.x / camera.zoom;
+    camera.target.y -= screenDelta.y / camera.zoom;
+    if (game) ClampCamera(*game);
+}
+
+// Re-anchors the camera on the viewport corner, then keeps the board
+// covering the viewport, or centred in it when it is smaller.
+void GameRenderer::ClampCamera(const Game& game) {
+    camera.target = GetScreenToWorld2D(Vector2{ viewport.x, viewport.y }, camera);
+    camera.offset = Vector2{ viewport.x, viewport.y };
+
+    float viewW = viewport.width / camera.zoom;
+    float viewH = viewport.height / camera.zoom;
+    float boardW = (float)(game.cols * CELL_SIZE);
+    float boardH = (float)(game.rows * CELL_SIZE);
+    if (boardW <= viewW) camera.target.x = (boardW - viewW) * 0.5f;
+    else camera.target.x = fmaxf(0.0f, fminf(camera.target.x, boardW - viewW));
+    if (boardH <= viewH) camera.target.y = (boardH - viewH) * 0.5f;
+    else camera.target.y = fmaxf(0.0f, fminf(camera.target.y, boardH - viewH));
+}
+
+bool GameRenderer::CellAt(const Game& game, Vector2 mouse, int& row, int& col) const {
+    if (!CheckCollisionPointRec(mouse, viewport)) return false;
+    Vector2 world = GetScreenToWorld2D(mouse, camera);
+    if (world.x < 0.0f || world.y < 0.0f) return false;
+
+    col = (int)(world.x / CELL_SIZE);
+    row = (int)(world.y / CELL_SIZE);
+    return col < game.cols && row < game.rows;
+}
+
+bool GameRenderer::CellAt(Vector2 mouse, long long& row, long long& col) const {
+    if (!CheckCollisionPointRec(mouse, viewport)) return false;
+    Vector2 world = GetScreenToWorld2D(mouse, camera);
+    col = (long long)floorf(world.x / CELL_SIZE);
+    row = (long long)floorf(world.y / CELL_SIZE);
+    return true;
+}
+
+void GameRenderer::VisibleRange(const Game& game, int& r0, int& r1, int& c0, int& c1) const {
+    Vector2 tl = GetScreenToWorld2D(Vector2{ viewport.x, viewport.y }, camera);
+    Vector2 br = GetScreenToWorld2D(Vector2{ viewport.x + viewport.width, viewport.y + viewport.height }, camera);
+    r0 = (int)fmaxf(0.0f, floorf(tl.y / CELL_SIZE));
+    c0 = (int)fmaxf(0.0f, floorf(tl.x / CELL_SIZE));
+    r1 = (int)fminf((float)(game.rows - 1), floorf(br.y / CELL_SIZE));
+    c1 = (int)fminf((float)(game.cols - 1), floorf(br.x / CELL_SIZE));
+}
+
+static Color GetNumberColor(int n) {
+    switch (n) {
+    case 1: return BLUE;
+    case 2: return GREEN;
+    case 3: return RED;
+    case 4: return DARKBLUE;
+    case 5: return MAROON;
+    case 6: return SKYBLUE;
+    case 7: return BLACK;
+    case 8: return GRAY;
+    default: return BLACK;
+    }
+}
+
+static int TileFor(uint8_t cell, bool exploded, bool gameOver) {
+    CellState state = (CellState)((cell & Grid::STATE_MASK) >> Grid::STATE_SHIFT);
+    bool isMine = (cell & Grid::MINE_BIT) != 0;
+    if (state == CellState::Revealed) {
+        if (!isMine) return TILE_OPEN + ((cell & Grid::ADJ_MASK) >> Grid::ADJ_SHIFT);
+        return exploded ? TILE_EXPLODED : TILE_MINE;
+    }
+    if (gameOver && isMine) {
+        if (state == CellState::Flagged) return TILE_MINE_FLAGGED;
+        if (state == CellState::Questioned) return TILE_MINE_QUESTIONED;
+        return TILE_MINE_HIDDEN;
+    }
+    if (state == CellState::Flagged) return TILE_FLAG;
+    if (state == CellState::Questioned) return TILE_QUESTION;
+    return TILE_HIDDEN;
+}
+
+static int TileFor(const Game& game, int idx) {
+    const Grid& grid = game.grid;
+    bool exploded = grid.RowOf(idx) == game.explodedRow && grid.ColOf(idx) == game.explodedCol;
+    return TileFor(grid.Data()[idx], exploded, game.gameOver);
+}
+
+void GameRenderer::DrawRect(int x, int y, int w, int h, Color c) {
+    DrawRectangle(x, y, w, h, c);
+    stats.drawCalls++;
+}
+
+// Sprites are packed at the size they are drawn, so a cell sprite is a
+// 1:1 blit centred in the cell.
+void GameRenderer::DrawSprite(int sprite, int px, int py, Color tint) {
+    const SpriteRect& r = SPRITES[sprite];
+    Vector2 at = { (float)(px + (CELL_SIZE - r.width) / 2), (float)(py + (CELL_SIZE - r.height) / 2) };
+    DrawTextureRec(sprites, SpriteSource(sprite), at, tint);
+    stats.drawCalls++;
+}
+
+void GameRenderer::DrawCenteredText(const char* text, int px, int py, int fontSize, Color c) {
+    int tw = MeasureText(text, fontSize);
+    DrawText(text, px + (CELL_SIZE - tw) / 2, py + (CELL_SIZE - fontSize) / 2, fontSize, c);
+    stats.drawCalls += 2;
+}
+
+void GameRenderer::DrawMineTile(bool exploded, int px, int py) {
+    DrawSprite(exploded ? SPRITE_BOMB_EXPLODED : SPRITE_BOMB, px, py, WHITE);
+}
+
+// Draws one cell from primitives. This is how every cell used to be drawn
+// each frame; it now only fills the atlas, or the whole board when the
+// cache is switched off for comparison.
+void GameRenderer::DrawTile(int tile, int px, int py) {
+    Color unopenedBg = Color{ 160,160,160,255 };
+    Color openedBg = Color{ 205,205,205,255 };
+    Color borderColor = DARKGRAY;
+    bool opened = tile >= TILE_OPEN && tile <= TILE_EXPLODED;
+    if (opened) {
+        DrawRect(px, py, CELL_SIZE, CELL_SIZE, openedBg);
+    }
+    else {
+        DrawRect(px, py, CELL_SIZE, CELL_SIZE, unopenedBg);
+        DrawRect(px + 1, py + 1, CELL_SIZE - 2, 2, Color{ 230,230,230,255 });
+        DrawRect(px + 1, py + 1, 2, CELL_SIZE - 2, Color{ 230,230,230,255 });
+    }
+    DrawRectangleLines(px, py, CELL_SIZE, CELL_SIZE, borderColor);
+    stats.drawCalls++;
+
+    if (tile > TILE_OPEN && tile < TILE_MINE) {
+        int adjacent = tile - TILE_OPEN;
+        DrawSprite(SPRITE_DIGIT + adjacent - 1, px, py, GetNumberColor(adjacent));
+    }
+    else if (tile == TILE_MINE || tile == TILE_EXPLODED) {
+        DrawMineTile(tile == TILE_EXPLODED, px, py);
+    }
+    else {
+        if (tile == TILE_FLAG || tile == TILE_MINE_FLAGGED) DrawSprite(SPRITE_FLAG, px, py, WHITE);
+        else if (tile == TILE_QUESTION || tile == TILE_MINE_QUESTIONED) DrawSprite(SPRITE_QUESTION, px, py, WHITE);
+        if (tile >= TILE_MINE_HIDDEN) DrawMineTile(false, px, py);
+    }
+}
+
+void GameRenderer::BuildAtlas() {
+    atlas = LoadRenderTexture(TILE_COUNT * CELL_SIZE, CELL_SIZE);
+    BeginTextureMode(atlas);
+    ClearBackground(BLANK);
+    for (int t = 0; t < TILE_COUNT; t++) DrawTile(t, t * CELL_SIZE, 0);
+    EndTextureMode();
+}
+
+// Render textures are stored bottom-up, hence the negative source heights.
+void GameRenderer::BlitTile(int tile, int px, int py) {
+    Rectangle src = { (float)(tile * CELL_SIZE), 0.0f, (float)CELL_SIZE, -(float)CELL_SIZE };
+    DrawTextureRec(atlas.texture, src, Vector2{ (float)px, (float)py }, WHITE);
+    stats.drawCalls++;
+    stats.cellsDrawn++;
+}
+
+bool GameRenderer::UpdateCache(Game& game) {
+    int w = game.cols * CELL_SIZE;
+    int h = game.rows * CELL_SIZE;
+    if (w > MAX_CACHE_PX || h > MAX_CACHE_PX) return false;
+
+    if (cache.id == 0 || cacheRows != game.rows || cacheCols != game.cols) {
+        if (cache.id != 0) UnloadRenderTexture(cache);
+        cache = LoadRenderTexture(w, h);
+        if (cache.id == 0) return false;
+        cacheRows = game.rows;
+        cacheCols = game.cols;
+        game.allDirty = true;
+    }
+
+    if (game.allDirty || !game.dirtyCells.empty()) {
+        const Grid& grid = game.grid;
+        BeginTextureMode(cache);
+        if (game.allDirty) {
+            for (int row = 0; row < game.rows; row++) {
+                int idx = grid.Index(row, 0);
+                for (int col = 0; col < game.cols; col++, idx++) {
+                    BlitTile(TileFor(game, idx), col * CELL_SIZE, row * CELL_SIZE);
+                }
+            }
+        }
+        else {
+            for (int idx : game.dirtyCells) {
+                BlitTile(TileFor(game, idx), grid.ColOf(idx) * CELL_SIZE, grid.RowOf(idx) * CELL_SIZE);
+            }
+        }
+        EndTextureMode();
+    }
+    game.ClearDirty();
+    return true;
+}
+
+void GameRenderer::DrawGrid(Game& game) {
+    stats = RenderStats{};
+    game.trackDirty = true;
+    if (atlas.id == 0) BuildAtlas();
+
+    bool cached = useCache && UpdateCache(game);
+    if (!cached && cache.id != 0) {
+        // The cache misses whatever changes from here on, so drop it.
+        UnloadRenderTexture(cache);
+        cache = RenderTexture2D{ 0 };
+    }
+
+    BeginScissorMode((int)viewport.x, (int)viewport.y, (int)viewport.width, (int)viewport.height);
+    BeginMode2D(camera);
+    if (cached) {
+        Rectangle src = { 0.0f, 0.0f, (float)(game.cols * CELL_SIZE), -(float)(game.rows * CELL_SIZE) };
+        DrawTextureRec(cache.texture, src, Vector2{ 0.0f, 0.0f }, WHITE);
+        stats.drawCalls++;
+    }
+    else {
+        int r0, r1, c0, c1;
+        VisibleRange(game, r0, r1, c0, c1);
+        const Grid& grid = game.grid;
+        for (int row = r0; row <= r1; row++) {
+            int idx = grid.Index(row, c0);
+            for (int col = c0; col <= c1; col++, idx++) {
+                if (useCache) BlitTile(TileFor(game, idx), col * CELL_SIZE, row * CELL_SIZE);
+                else {
+                    DrawTile(TileFor(game, idx), col * CELL_SIZE, row * CELL_SIZE);
+                    stats.cellsDrawn++;
+                }
+            }
+        }
+        game.ClearDirty();
+    }
+    if (probabilities) DrawProbabilities(game);
+    EndMode2D();
+    EndScissorMode();
+}
+
+void GameRenderer::DrawProbabilities(const Game& game) {
+    int r0, r1, c0, c1;
+    VisibleRange(game, r0, r1, c0, c1);
+    const Grid& grid = game.grid;
+    const std::vector<float>& prob = *probabilities;
+    if ((int)prob.size() != grid.PaddedSize()) return;
+    bool labels = CELL_SIZE * camera.zoom >= 24.0f;
+    for (int row = r0; row <= r1; row++) {
+        int idx = grid.Index(row, c0);
+        for (int col = c0; col <= c1; col++, idx++) {
+            float p = prob[idx];
+            CellState s = grid.State(idx);
+            if (p < 0.0f || s == CellState::Revealed || s == CellState::Flagged) continue;
+            int px = col * CELL_SIZE, py = row * CELL_SIZE;
+            DrawRect(px, py, CELL_SIZE, CELL_SIZE, Color{ (unsigned char)(255 * p), (unsigned char)(255 * (1.0f - p)), 0, 90 });
+            if (labels) DrawCenteredText(TextFormat("%d", (int)(p * 100.0f + 0.5f)), px, py, 18, BLACK);
+        }
+    }
+}
+
+// Endless boards have no cache: only the visible cells are drawn, and cells
+// of chunks that were never loaded come back as plain hidden tiles.
+void GameRenderer::DrawEndless(EndlessBoard& board) {
+    stats = RenderStats{};
+    if (atlas.id == 0) BuildAtlas();
+
+    Vector2 tl = GetScreenToWorld2D(Vector2{ viewport.x, viewport.y }, camera);
+    Vector2 br = GetScreenToWorld2D(Vector2{ viewport.x + viewport.width, viewport.y + viewport.height }, camera);
+    long long r0 = (long long)floorf(tl.y / CELL_SIZE), r1 = (long long)floorf(br.y / CELL_SIZE);
+    long long c0 = (long long)floorf(tl.x / CELL_SIZE), c1 = (long long)floorf(br.x / CELL_SIZE);
+
+    BeginScissorMode((int)viewport.x, (int)viewport.y, (int)viewport.width, (int)viewport.height);
+    BeginMode2D(camera);
+    for (long long row = r0; row <= r1; row++) {
+        for (long long col = c0; col <= c1; col++) {
+            bool exploded = board.gameOver && row == board.explodedRow && col == board.explodedCol;
+            BlitTile(TileFor(board.Peek(row, col), exploded, board.gameOver), (int)(col * CELL_SIZE), (int)(row * CELL_SIZE));
+        }
+    }
+    EndMode2D();
+    EndScissorMode();
+}
+
+void GameRenderer::DrawHint(int row, int col, bool mine) {
+    BeginScissorMode((int)viewport.x, (int)viewport.y, (int)viewport.width, (int)viewport.height);
+    BeginMode2D(camera);
+    Rectangle r = { (float)(col * CELL_SIZE), (float)(row * CELL_SIZE), (float)CELL_SIZE, (float)CELL_SIZE };
+    DrawRectangleLinesEx(r, 4.0f, mine ? RED : GREEN);
+    EndMode2D();
+    EndScissorMode();
+}
@@ -0,0 +1,81 @@
+#pragma once
+#include <raylib.h>
+#include "assets.h"
+#include "endless.h"
+#include "game.h"
+
+const int CELL_SIZE = 48; 
+
+// Every distinct cell appearance, pre-rendered once into the atlas.
+enum Tile {
+    TILE_HIDDEN,
+    TILE_FLAG,
+    TILE_QUESTION,
+    TILE_OPEN,          // TILE_OPEN + n for a revealed cell with n adjacent mines
+    TILE_MINE = TILE_OPEN + 9,
+    TILE_EXPLODED,
+    TILE_MINE_HIDDEN,
+    TILE_MINE_FLAGGED,
+    TILE_MINE_QUESTIONED,
+    TILE_COUNT
+};
+
+struct RenderStats {
+    int drawCalls = 0;
+    int cellsDrawn = 0;
+};
+
+// Draws the board from a render texture cache. Only the cells the Game lists
+// in dirtyCells are redrawn into the cache, each with a single blit from a
+// tile atlas; the cache itself is one textured quad per frame. The board is
+// seen through a zoomable, pannable camera clipped to the viewport; boards
+// too large to cache are drawn straight from the atlas, visible cells only.
+class GameRenderer {
+public:
+    bool useCache = true;
+    RenderStats stats;
+    Rectangle viewport = { 0 };
+    Camera2D camera = { { 0.0f, 0.0f }, { 0.0f, 0.0f }, 0.0f, 1.0f };
+    // When set, DrawGrid shades hidden cells by mine probability (indexed
+    // like Grid, negative for cells without one) and prints percentages.
+    const std::vector<float>* probabilities = nullptr;
+
+    // Uploads the embedded sprite atlas; needs the window to be open.
+    void LoadSprites();
+    void Unload();
+    // face is 0-3: playing, worried, lost, won.
+    void DrawFace(int face, Rectangle dest);
+
+    void SetViewport(int x, int y, int width, int height);
+    void ResetCamera(const Game& game);
+    void CenterCamera(long long row, long long col);
+    // A null game leaves the camera unbounded, as in endless mode.
+    void Zoom(const Game* game, float wheel, Vector2 anchor);
+    void Pan(const Game* game, Vector2 screenDelta);
+
+    bool CellAt(const Game& game, Vector2 mouse, int& row, int& col) const;
+    bool CellAt(Vector2 mouse, long long& row, long long& col) const;
+    void DrawGrid(Game& game);
+    void DrawEndless(EndlessBoard& board);
+    // Outlines a solver hint: green for a safe cell, red for a mine.
+    void DrawHint(int row, int col, bool mine);
+
+private:
+    void ClampCamera(const Game& game);
+    void VisibleRange(const Game& game, int& r0, int& r1, int& c0, int& c1) const;
+    void BuildAtlas();
+    bool UpdateCache(Game& game);
+    void DrawTile(int tile, int px, int py);
+    void BlitTile(int tile, int px, int py);
+    void DrawRect(int x, int y, int w, int h, Color c);
+    void DrawSprite(int sprite, int px, int py, Color tint);
+    void DrawCenteredText(const char* text, int px, int py, int fontSize, Color c);
+    void DrawMineTile(bool exploded, int px, int py);
+    void DrawProbabilities(const Game& game);
+
+    Texture2D sprites = { 0 };
+    RenderTexture2D atlas = { 0 };
+    RenderTexture2D cache = { 0 };
+    int cacheRows = 0;
+    int cacheCols = 0;
+};
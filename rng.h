@@ -0,0 +1,82 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <random>
+
+inline uint64_t SplitMix64(uint64_t& state) {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// xoshiro256** by Blackman and Vigna. Small, fast and statistically solid;
+// each Game owns one, so generation never touches shared state.
+class Xoshiro256 {
+public:
+    explicit Xoshiro256(uint64_t seed = 0) { Seed(seed); }
+
+    void Seed(uint64_t seed) {
+        uint64_t sm = seed;
+        for (int i = 0; i < 4; i++) s[i] = SplitMix64(sm);
+    }
+
+    uint64_t Next() {
+        uint64_t result = Rotl(s[1] * 5, 7) * 9;
+        uint64_t t = s[1] << 17;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = Rotl(s[3], 45);
+        return result;
+    }
+
+    // Uniform integer in [0, n) without modulo bias (Lemire's method on the
+    // high 32 bits for small n, rejection on 64-bit values otherwise).
+    uint64_t Below(uint64_t n) {
+        if (n <= 0xFFFFFFFFULL) {
+            uint64_t m = (Next() >> 32) * n;
+            uint32_t low = (uint32_t)m;
+            if (low < n) {
+                uint32_t threshold = (uint32_t)(0x100000000ULL % n);
+                while (low < threshold) {
+                    m = (Next() >> 32) * n;
+                    low = (uint32_t)m;
+                }
+            }
+            return m >> 32;
+        }
+        uint64_t limit = UINT64_MAX - UINT64_MAX % n;
+        uint64_t x;
+        do { x = Next(); } while (x >= limit);
+        return x % n;
+    }
+
+    // Advances the state by 2^128 calls, giving non-overlapping streams.
+    void Jump() {
+        static const uint64_t JUMP[] = { 0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL, 0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL };
+        uint64_t t[4] = { 0, 0, 0, 0 };
+        for (int i = 0; i < 4; i++) {
+            for (int b = 0; b < 64; b++) {
+                if (JUMP[i] & (1ULL << b)) {
+                    for (int k = 0; k < 4; k++) t[k] ^= s[k];
+                }
+                Next();
+            }
+        }
+        for (int k = 0; k < 4; k++) s[k] = t[k];
+    }
+
+private:
+    static uint64_t Rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+    uint64_t s[4];
+};
+
+// Non-deterministic seed for games started without one.
+inline uint64_t RandomSeed() {
+    std::random_device rd;
+    uint64_t seed = ((uint64_t)rd() << 32) ^ rd();
+    return seed ^ (uint64_t)std::chrono::steady_clock::now().time_since_epoch().count();
+}
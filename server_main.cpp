@@ -0,0 +1,250 @@
+#include "session.h"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+struct ServerConfig {
+    std::string socketPath = "minesweeper.sock";
+    // Listens on 127.0.0.1 instead of the Unix socket when set.
+    int port = 0;
+    int threads = 0;
+    int shards = 64;
+};
+
+// One client. Replies are queued in out and written as the socket allows;
+// events is what the epoll set currently waits for.
+struct Connection {
+    int fd;
+    std::string in;
+    std::string out;
+    size_t sent = 0;
+    uint32_t events = EPOLLIN | EPOLLRDHUP;
+    std::vector<uint64_t> owned;
+};
+
+// Longest command accepted; BOARD replies can be longer.
+static const size_t MAX_LINE = 4096;
+// Unsent reply bytes at which a connection stops being read, so a client
+// that sends commands without reading the replies cannot grow out without
+// bound. Reading resumes once Flush gets below it again.
+static const size_t MAX_PENDING = 1 << 20;
+
+static bool Backlogged(const Connection& conn) {
+    return conn.out.size() - conn.sent >= MAX_PENDING;
+}
+
+static std::atomic<bool> stopping(false);
+
+static void OnSignal(int) {
+    stopping = true;
+}
+
+static void Usage() {
+    printf("usage: minesweeper-server [--socket PATH | --port N] [--threads N] [--shards N]\n");
+}
+
+static bool ParseArgs(int argc, char** argv, ServerConfig& cfg) {
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        if (i + 1 >= argc) return false;
+        const char* val = argv[++i];
+        if (strcmp(arg, "--socket") == 0) cfg.socketPath = val;
+        else if (strcmp(arg, "--port") == 0) cfg.port = atoi(val);
+        else if (strcmp(arg, "--threads") == 0) cfg.threads = atoi(val);
+        else if (strcmp(arg, "--shards") == 0) cfg.shards = atoi(val);
+        else return false;
+    }
+    return cfg.port >= 0 && cfg.port < 65536 && cfg.shards > 0;
+}
+
+static int Listen(const ServerConfig& cfg) {
+    int fd;
+    if (cfg.port > 0) {
+        fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (fd < 0) return -1;
+        int one = 1;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        sockaddr_in addr = {};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons((uint16_t)cfg.port);
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        if (bind(fd, (sockaddr*)&addr, sizeof(addr)) < 0) { close(fd); return -1; }
+    } else {
+        sockaddr_un addr = {};
+        if (cfg.socketPath.size() >= sizeof(addr.sun_path)) return -1;
+        fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (fd < 0) return -1;
+        addr.sun_family = AF_UNIX;
+        memcpy(addr.sun_path, cfg.socketPath.c_str(), cfg.socketPath.size() + 1);
+        unlink(cfg.socketPath.c_str());
+        if (bind(fd, (sockaddr*)&addr, sizeof(addr)) < 0) { close(fd); return -1; }
+    }
+    if (listen(fd, SOMAXCONN) < 0) { close(fd); return -1; }
+    return fd;
+}
+
+// Writes what the socket takes. Returns false if the connection failed.
+static bool Flush(int epoll, Connection& conn) {
+    while (conn.sent < conn.out.size()) {
+        ssize_t n = send(conn.fd, conn.out.data() + conn.sent, conn.out.size() - conn.sent, MSG_NOSIGNAL);
+        if (n > 0) { conn.sent += (size_t)n; continue; }
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+        return false;
+    }
+    if (conn.sent == conn.out.size()) {
+        conn.out.clear();
+        conn.sent = 0;
+    }
+    // Only ask for EPOLLOUT while replies are waiting, and for input while
+    // they are not backed up.
+    bool pending = !conn.out.empty();
+    uint32_t events = (Backlogged(conn) ? 0u : (uint32_t)(EPOLLIN | EPOLLRDHUP)) | (pending ? (uint32_t)EPOLLOUT : 0u);
+    if (events != conn.events) {
+        epoll_event ev = {};
+        ev.events = events;
+        ev.data.ptr = &conn;
+        epoll_ctl(epoll, EPOLL_CTL_MOD, conn.fd, &ev);
+        conn.events = events;
+    }
+    return true;
+}
+
+// Reads what arrived and runs complete lines until the replies back up;
+// the rest wait in in. Returns false once the connection should be closed.
+static bool Receive(SessionTable& table, Connection& conn) {
+    char buf[65536];
+    bool open = true;
+    while (!Backlogged(conn) && conn.in.size() < MAX_PENDING) {
+        ssize_t n = recv(conn.fd, buf, sizeof(buf), 0);
+        if (n > 0) {
+            conn.in.append(buf, (size_t)n);
+            if ((size_t)n < sizeof(buf)) break;
+            continue;
+        }
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+        // End of stream or an error: the lines already here still run.
+        open = false;
+        break;
+    }
+
+    size_t start = 0, end;
+    while (!Backlogged(conn) && (end = conn.in.find('\n', start)) != std::string::npos) {
+        size_t stop = end;
+        if (stop > start && conn.in[stop - 1] == '\r') stop--;
+        conn.in[stop] = 0;
+        table.Execute(conn.in.c_str() + start, conn.out, conn.owned);
+        start = end + 1;
+    }
+    conn.in.erase(0, start);
+    if (conn.in.size() > MAX_LINE && conn.in.find('\n') == std::string::npos) {
+        conn.out += "ERR line too long\n";
+        return false;
+    }
+    return open;
+}
+
+// Each worker has its own epoll set. All of them wait on the listening
+// socket with EPOLLEXCLUSIVE, so a new connection wakes one worker, which
+// keeps it from then on.
+static void Worker(SessionTable& table, int listener, bool tcp) {
+    int epoll = epoll_create1(EPOLL_CLOEXEC);
+    epoll_event ev = {};
+    ev.events = EPOLLIN | EPOLLEXCLUSIVE;
+    ev.data.ptr = nullptr;
+    epoll_ctl(epoll, EPOLL_CTL_ADD, listener, &ev);
+
+    std::vector<Connection*> conns;
+    auto drop = [&](Connection* conn) {
+        for (uint64_t id : conn->owned) table.Close(id);
+        epoll_ctl(epoll, EPOLL_CTL_DEL, conn->fd, nullptr);
+        close(conn->fd);
+        conns.erase(std::find(conns.begin(), conns.end(), conn));
+        delete conn;
+    };
+
+    const int MAX_EVENTS = 256;
+    epoll_event events[MAX_EVENTS];
+    while (!stopping) {
+        int n = epoll_wait(epoll, events, MAX_EVENTS, 250);
+        for (int i = 0; i < n; i++) {
+            Connection* conn = (Connection*)events[i].data.ptr;
+            if (!conn) {
+                int fd;
+                while ((fd = accept4(listener, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC)) >= 0) {
+                    if (tcp) {
+                        int one = 1;
+                        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+                    }
+                    conn = new Connection();
+                    conn->fd = fd;
+                    epoll_event cev = {};
+                    cev.events = EPOLLIN | EPOLLRDHUP;
+                    cev.data.ptr = conn;
+                    epoll_ctl(epoll, EPOLL_CTL_ADD, fd, &cev);
+                    conns.push_back(conn);
+                }
+                continue;
+            }
+            bool ok = true;
+            if (events[i].events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) ok = Receive(table, *conn);
+            // A peer that shut down its side still gets the replies the
+            // socket takes right away.
+            ok = Flush(epoll, *conn) && ok;
+            // Lines held back while the replies were backed up run as soon
+            // as they drain, as no new input may arrive to trigger them.
+            while (ok && !Backlogged(*conn) && conn->in.find('\n') != std::string::npos) {
+                ok = Receive(table, *conn);
+                ok = Flush(epoll, *conn) && ok;
+            }
+            if (!ok) drop(conn);
+        }
+    }
+    while (!conns.empty()) drop(conns.back());
+    close(epoll);
+}
+
+int main(int argc, char** argv) {
+    ServerConfig cfg;
+    if (!ParseArgs(argc, argv, cfg)) { Usage(); return 1; }
+    if (cfg.threads <= 0) cfg.threads = (int)std::max(1u, std::thread::hardware_concurrency());
+
+    int listener = Listen(cfg);
+    if (listener < 0) {
+        if (cfg.port > 0) fprintf(stderr, "cannot listen on 127.0.0.1:%d: %s\n", cfg.port, strerror(errno));
+        else fprintf(stderr, "cannot listen on %s: %s\n", cfg.socketPath.c_str(), strerror(errno));
+        return 1;
+    }
+    signal(SIGINT, OnSignal);
+    signal(SIGTERM, OnSignal);
+    signal(SIGPIPE, SIG_IGN);
+
+    SessionTable table(cfg.shards);
+    if (cfg.port > 0) printf("listening on 127.0.0.1:%d with %d threads\n", cfg.port, cfg.threads);
+    else printf("listening on %s with %d threads\n", cfg.socketPath.c_str(), cfg.threads);
+    fflush(stdout);
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < cfg.threads; t++) workers.emplace_back(Worker, std::ref(table), listener, cfg.port > 0);
+    for (std::thread& w : workers) w.join();
+
+    close(listener);
+    if (cfg.port == 0) unlink(cfg.socketPath.c_str());
+    printf("served %lld moves\n", table.Moves());
+    return 0;
+}
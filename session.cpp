@@ -0,0 +1,198 @@
+#include "session.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+
+namespace {
+
+// Reads the command line word by word.
+struct Parser {
+    const char* p;
+
+    void SkipSpaces() {
+        while (*p == ' ' || *p == '\t') p++;
+    }
+    bool Word(const char* w) {
+        SkipSpaces();
+        size_t n = strlen(w);
+        if (strncmp(p, w, n) != 0 || (p[n] != 0 && p[n] != ' ' && p[n] != '\t')) return false;
+        p += n;
+        return true;
+    }
+    bool Int(long long& v) {
+        SkipSpaces();
+        char* end;
+        v = strtoll(p, &end, 10);
+        if (end == p) return false;
+        p = end;
+        return true;
+    }
+    bool Id(uint64_t& v) {
+        SkipSpaces();
+        if (*p == '-') return false;
+        char* end;
+        v = strtoull(p, &end, 10);
+        if (end == p) return false;
+        p = end;
+        return true;
+    }
+    bool End() {
+        SkipSpaces();
+        return *p == 0;
+    }
+};
+
+void Reply(std::string& out, const char* text) {
+    out += text;
+    out += '\n';
+}
+
+}
+
+SessionTable::SessionTable(int count, size_t depth)
+    : shards(new Shard[(size_t)(count > 0 ? count : 1)]), shardCount(count > 0 ? count : 1), poolDepth(depth) {}
+
+void SessionTable::Execute(const char* line, std::string& out, std::vector<uint64_t>& owned) {
+    Parser in{ line };
+    long long a, b, c;
+    uint64_t id;
+    bool leftClick = false;
+    if ((leftClick = in.Word("CLICK")) || in.Word("FLAG")) {
+        if (!in.Id(id) || !in.Int(a) || !in.Int(b) || !in.End()) return Reply(out, "ERR usage: CLICK|FLAG id row col");
+        Move(id, (int)std::max(-1LL, std::min(a, MAX_CELLS)), (int)std::max(-1LL, std::min(b, MAX_CELLS)), leftClick, out);
+    } else if (in.Word("NEW")) {
+        if (!in.Int(a) || !in.Int(b) || !in.Int(c)) return Reply(out, "ERR usage: NEW rows cols mines [seed]");
+        uint64_t seed = 0;
+        bool seeded = in.Id(seed);
+        if (!in.End()) return Reply(out, "ERR usage: NEW rows cols mines [seed]");
+        if (a < 1 || b < 1 || a > MAX_CELLS || b > MAX_CELLS || a * b > MAX_CELLS || c < 0 || c > a * b - 9) return Reply(out, "ERR bad board size");
+        New((int)a, (int)b, (int)c, seeded ? seed : RandomSeed(), out, owned);
+    } else if (in.Word("BOARD")) {
+        if (!in.Id(id) || !in.End()) return Reply(out, "ERR usage: BOARD id");
+        Board(id, out);
+    } else if (in.Word("CLOSE")) {
+        if (!in.Id(id) || !in.End()) return Reply(out, "ERR usage: CLOSE id");
+        if (!Close(id)) return Reply(out, "ERR no such session");
+        auto it = std::find(owned.rbegin(), owned.rend(), id);
+        if (it != owned.rend()) owned.erase(std::next(it).base());
+        Reply(out, "OK");
+    } else if (in.Word("STATS")) {
+        char buf[64];
+        snprintf(buf, sizeof(buf), "OK %zu %lld", Sessions(), Moves());
+        Reply(out, buf);
+    } else {
+        Reply(out, "ERR unknown command");
+    }
+}
+
+void SessionTable::New(int rows, int cols, int mines, uint64_t seed, std::string& out, std::vector<uint64_t>& owned) {
+    int index = (int)(nextShard.fetch_add(1, std::memory_order_relaxed) % (uint64_t)shardCount);
+    Shard& shard = shards[(size_t)index];
+    std::unique_ptr<Session> session;
+    uint64_t id;
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        // A pooled game of the same size needs no buffer resized; only the
+        // most recent few are looked at.
+        std::vector<std::unique_ptr<Session>>& pool = shard.pool;
+        for (size_t i = pool.size(), seen = 0; i-- > 0 && seen < 8; seen++) {
+            if (pool[i]->game.rows == rows && pool[i]->game.cols == cols) {
+                std::swap(pool[i], pool.back());
+                break;
+            }
+        }
+        if (!pool.empty()) {
+            session = std::move(pool.back());
+            pool.pop_back();
+        }
+        id = shard.nextId++ * (uint64_t)shardCount + (uint64_t)index;
+    }
+    if (!session) session.reset(new Session());
+    session->id = id;
+    session->game.threads = 1;
+    session->game.Init(rows, cols, mines, seed);
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.live.emplace(id, std::move(session));
+    }
+    owned.push_back(id);
+
+    char buf[64];
+    snprintf(buf, sizeof(buf), "OK %llu %llu", (unsigned long long)id, (unsigned long long)seed);
+    Reply(out, buf);
+}
+
+void SessionTable::Move(uint64_t id, int row, int col, bool leftClick, std::string& out) {
+    Shard& shard = ShardOf(id);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.live.find(id);
+    if (it == shard.live.end()) return Reply(out, "ERR no such session");
+    Game& game = it->second->game;
+    if (row < 0 || row >= game.rows || col < 0 || col >= game.cols) return Reply(out, "ERR cell out of range");
+    game.HandleClick(row, col, leftClick);
+    shard.moves++;
+
+    char buf[64];
+    snprintf(buf, sizeof(buf), "OK %s %d %d", game.victory ? "won" : (game.gameOver ? "lost" : "playing"),
+             game.revealedCnt, game.flagsLeft);
+    Reply(out, buf);
+}
+
+void SessionTable::Board(uint64_t id, std::string& out) {
+    static const char HIDDEN[] = { '.', 0, 'F', '?' };
+    Shard& shard = ShardOf(id);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.live.find(id);
+    if (it == shard.live.end()) return Reply(out, "ERR no such session");
+    const Grid& grid = it->second->game.grid;
+
+    char buf[48];
+    snprintf(buf, sizeof(buf), "OK %d %d ", grid.Rows(), grid.Cols());
+    out += buf;
+    size_t at = out.size();
+    out.resize(at + (size_t)grid.Rows() * grid.Cols());
+    for (int r = 0; r < grid.Rows(); r++) {
+        for (int c = 0; c < grid.Cols(); c++) {
+            int idx = grid.Index(r, c);
+            CellState s = grid.State(idx);
+            char ch = HIDDEN[(int)s];
+            if (s == CellState::Revealed) ch = grid.IsMine(idx) ? '*' : (char)('0' + grid.Adjacent(idx));
+            out[at++] = ch;
+        }
+    }
+    out += '\n';
+}
+
+bool SessionTable::Close(uint64_t id) {
+    Shard& shard = ShardOf(id);
+    std::unique_ptr<Session> dropped;
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.live.find(id);
+        if (it == shard.live.end()) return false;
+        if (shard.pool.size() < poolDepth) shard.pool.push_back(std::move(it->second));
+        else dropped = std::move(it->second);
+        shard.live.erase(it);
+    }
+    return true;
+}
+
+size_t SessionTable::Sessions() {
+    size_t n = 0;
+    for (int i = 0; i < shardCount; i++) {
+        std::lock_guard<std::mutex> lock(shards[(size_t)i].mutex);
+        n += shards[(size_t)i].live.size();
+    }
+    return n;
+}
+
+long long SessionTable::Moves() {
+    long long n = 0;
+    for (int i = 0; i < shardCount; i++) {
+        std::lock_guard<std::mutex> lock(shards[(size_t)i].mutex);
+        n += shards[(size_t)i].moves;
+    }
+    return n;
+}
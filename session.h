@@ -0,0 +1,72 @@
+#pragma once
+#include "game.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Games hosted by minesweeper-server, addressed by id, and the line protocol
+// that plays them. One command per line, one reply line per command:
+//
+//   NEW rows cols mines [seed]   OK id seed
+//   CLICK id row col             OK playing|won|lost revealed flagsLeft
+//   FLAG id row col              (same; a click on a revealed number chords)
+//   BOARD id                     OK rows cols cells
+//   CLOSE id                     OK
+//   STATS                        OK sessions moves
+//
+// BOARD lists the cells row by row: '.' hidden, 'F' flagged, '?' questioned,
+// '0'-'8' revealed, '*' a revealed mine. Errors reply ERR and a message.
+//
+// Sessions are spread over shards, each with its own lock, map and pool, so
+// connections on different threads rarely wait for each other. The id says
+// which shard holds a session. A command holds its shard's lock while it
+// runs; setting up a new game happens outside it. Closed sessions go back
+// to their shard's pool and keep their Game, whose grid, history and log
+// buffers are reused by the next game, so a steady stream of games stops
+// allocating once the pools are warm.
+class SessionTable {
+public:
+    // Largest board a client may ask for.
+    static constexpr long long MAX_CELLS = 1LL << 20;
+
+    explicit SessionTable(int shards = 64, size_t poolDepth = 256);
+
+    // Runs one command (no newline) and appends the reply, newline included,
+    // to out. Sessions it creates are added to owned, so the connection can
+    // close them when it goes away.
+    void Execute(const char* line, std::string& out, std::vector<uint64_t>& owned);
+    // False if there is no such session.
+    bool Close(uint64_t id);
+
+    size_t Sessions();
+    long long Moves();
+
+private:
+    struct Session {
+        uint64_t id = 0;
+        Game game;
+    };
+
+    struct Shard {
+        std::mutex mutex;
+        std::unordered_map<uint64_t, std::unique_ptr<Session>> live;
+        // Closed sessions kept for reuse, at most poolDepth.
+        std::vector<std::unique_ptr<Session>> pool;
+        uint64_t nextId = 0;
+        long long moves = 0;
+    };
+
+    Shard& ShardOf(uint64_t id) { return shards[(size_t)(id % (uint64_t)shardCount)]; }
+    void New(int rows, int cols, int mines, uint64_t seed, std::string& out, std::vector<uint64_t>& owned);
+    void Move(uint64_t id, int row, int col, bool leftClick, std::string& out);
+    void Board(uint64_t id, std::string& out);
+
+    std::unique_ptr<Shard[]> shards;
+    int shardCount;
+    size_t poolDepth;
+    std::atomic<uint64_t> nextShard{ 0 };
+};
@@ -0,0 +1,319 @@
+#include "analytics.h"
+#include "game.h"
+#include "board.h"
+#include "bot.h"
+#include "noguess.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct SimConfig {
+    int rows = 16;
+    int cols = 16;
+    int mines = 40;
+    long long games = 10000;
+    int threads = 0;
+    uint64_t seed = 0;
+    std::string bot = "simple";
+    // "fixed" plays the preset sizes on the compile-time Board.
+    std::string board = "dynamic";
+    int noGuessTries = 0;
+    std::string saveDir;
+    std::vector<std::string> replays;
+    long long passes = 1;
+    // Measure boards instead of playing them.
+    bool analyze = false;
+};
+
+struct WorkerResult {
+    long long wins = 0;
+    // No-guess boards that took more than one round of noGuessTries, and
+    // those still unverified after NOGUESS_ROUNDS rounds.
+    long long noGuessRetries = 0;
+    long long noGuessFailed = 0;
+    std::vector<double> latencies;
+    Histogram bbbv;
+    Histogram openings;
+    Histogram isolated;
+    Histogram openingSizes;
+    Histogram largestOpening;
+};
+
+static void Usage() {
+    printf("usage: minesweeper-sim [--rows N] [--cols N] [--mines N] [--games N]\n"
+           "                       [--threads N] [--seed S] [--bot random|simple|solver]\n"
+           "                       [--noguess TRIES] [--save-replays DIR] [--board dynamic|fixed]\n"
+           "       minesweeper-sim --analyze [--rows N] [--cols N] [--mines N] [--games N]\n"
+           "                       [--threads N] [--seed S] [--noguess TRIES]\n"
+           "       minesweeper-sim --replay FILE [--replay FILE ...] [--passes N]\n");
+}
+
+static bool ParseArgs(int argc, char** argv, SimConfig& cfg) {
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        if (strcmp(arg, "--analyze") == 0) {
+            cfg.analyze = true;
+            continue;
+        }
+        if (i + 1 >= argc) return false;
+        const char* val = argv[++i];
+        if (strcmp(arg, "--rows") == 0) cfg.rows = atoi(val);
+        else if (strcmp(arg, "--cols") == 0) cfg.cols = atoi(val);
+        else if (strcmp(arg, "--mines") == 0) cfg.mines = atoi(val);
+        else if (strcmp(arg, "--games") == 0) cfg.games = atoll(val);
+        else if (strcmp(arg, "--threads") == 0) cfg.threads = atoi(val);
+        else if (strcmp(arg, "--seed") == 0) cfg.seed = strtoull(val, nullptr, 0);
+        else if (strcmp(arg, "--bot") == 0) cfg.bot = val;
+        else if (strcmp(arg, "--board") == 0) cfg.board = val;
+        else if (strcmp(arg, "--noguess") == 0) cfg.noGuessTries = atoi(val);
+        else if (strcmp(arg, "--save-replays") == 0) cfg.saveDir = val;
+        else if (strcmp(arg, "--replay") == 0) cfg.replays.push_back(val);
+        else if (strcmp(arg, "--passes") == 0) cfg.passes = atoll(val);
+        else return false;
+    }
+    return cfg.passes > 0 && cfg.rows > 0 && cfg.cols > 0 && cfg.mines >= 0 && cfg.mines <= cfg.rows * cfg.cols - 9 && cfg.games > 0;
+}
+
+// Rounds of cfg.noGuessTries candidates drawn for one board before it is
+// given up on.
+static const int NOGUESS_ROUNDS = 8;
+
+// Draws candidates in rounds of cfg.noGuessTries until one is verified.
+// False once NOGUESS_ROUNDS rounds failed; the caller then plays a normal
+// board rather than passing an unverified one off as no-guess.
+static bool GenerateNoGuess(const SimConfig& cfg, NoGuessGenerator& generator, const BoardSpec& spec, int row, int col,
+                            uint64_t seed, Bitboard& layout, WorkerResult& out) {
+    Xoshiro256 rng(seed);
+    for (int round = 0; round < NOGUESS_ROUNDS; round++) {
+        if (generator.GenerateAt(spec, row, col, rng, cfg.noGuessTries, layout)) return true;
+        if (round == 0) out.noGuessRetries++;
+    }
+    out.noGuessFailed++;
+    return false;
+}
+
+static void PrintNoGuess(const SimConfig& cfg, const WorkerResult& total) {
+    printf("no-guess:  %.2f%% of boards needed more than %d tries, %.2f%% failed all %d and were played as normal boards\n",
+           100.0 * (double)total.noGuessRetries / (double)cfg.games, cfg.noGuessTries,
+           100.0 * (double)total.noGuessFailed / (double)cfg.games, cfg.noGuessTries * NOGUESS_ROUNDS);
+}
+
+static void RunWorker(const SimConfig& cfg, int id, std::atomic<long long>& next, WorkerResult& out) {
+    typedef std::chrono::steady_clock Clock;
+    std::unique_ptr<Bot> bot = MakeBot(cfg.bot, (uint64_t)id);
+    Game game(cfg.rows, cfg.cols, cfg.mines, cfg.seed);
+    long long maxMoves = 3LL * cfg.rows * cfg.cols;
+    NoGuessGenerator generator;
+    BoardSpec spec = { cfg.rows, cfg.cols, cfg.mines };
+    Bitboard layout;
+
+    // Game i always gets the same seed, whichever worker picks it up.
+    long long i;
+    while ((i = next.fetch_add(1, std::memory_order_relaxed)) < cfg.games) {
+        Clock::time_point start = Clock::now();
+        uint64_t state = cfg.seed + (uint64_t)i;
+        game.NewGame(SplitMix64(state));
+        bot->NewGame(game);
+        for (long long moves = 0; !game.gameOver && !game.victory && moves < maxMoves; moves++) {
+            Move m = bot->NextMove(game);
+            if (cfg.noGuessTries > 0 && game.firstClick && m.leftClick) {
+                // Generated where the click lands, so the wait is part of the game.
+                if (GenerateNoGuess(cfg, generator, spec, m.row, m.col, game.GetSeed(), layout, out)) game.SetMines(layout);
+            }
+            game.HandleClick(m.row, m.col, m.leftClick);
+        }
+        out.latencies.push_back(std::chrono::duration<double, std::micro>(Clock::now() - start).count());
+        if (game.victory) out.wins++;
+        if (!cfg.saveDir.empty()) game.log.Save(cfg.saveDir + "/game_" + std::to_string(i) + ".msr");
+    }
+}
+
+// The same games through the Minefield interface, on a compile-time Board
+// when the size is a preset. Such boards keep no move log, so there is no
+// no-guess generation or replay saving here.
+static void RunBoardWorker(const SimConfig& cfg, int id, std::atomic<long long>& next, WorkerResult& out) {
+    typedef std::chrono::steady_clock Clock;
+    std::unique_ptr<Bot> bot = MakeBot(cfg.bot, (uint64_t)id);
+    std::unique_ptr<Minefield> board = MakeBoard(cfg.rows, cfg.cols, cfg.mines, cfg.seed);
+    long long maxMoves = 3LL * cfg.rows * cfg.cols;
+
+    long long i;
+    while ((i = next.fetch_add(1, std::memory_order_relaxed)) < cfg.games) {
+        Clock::time_point start = Clock::now();
+        uint64_t state = cfg.seed + (uint64_t)i;
+        board->NewGame(SplitMix64(state));
+        bot->NewGame(*board);
+        for (long long moves = 0; !board->GameOver() && !board->Victory() && moves < maxMoves; moves++) {
+            Move m = bot->NextMove(*board);
+            board->HandleClick(m.row, m.col, m.leftClick);
+        }
+        out.latencies.push_back(std::chrono::duration<double, std::micro>(Clock::now() - start).count());
+        if (board->Victory()) out.wins++;
+    }
+}
+
+// Generates board i exactly as RunWorker does for a bot, whose first click
+// is the center, and records its metrics instead of playing it.
+static void RunAnalyzeWorker(const SimConfig& cfg, int, std::atomic<long long>& next, WorkerResult& out) {
+    Game game(cfg.rows, cfg.cols, cfg.mines, cfg.seed);
+    BoardAnalyzer analyzer;
+    NoGuessGenerator generator;
+    BoardSpec spec = { cfg.rows, cfg.cols, cfg.mines };
+    Bitboard layout;
+    std::vector<int> sizes;
+    int row = cfg.rows / 2, col = cfg.cols / 2;
+
+    long long i;
+    while ((i = next.fetch_add(1, std::memory_order_relaxed)) < cfg.games) {
+        uint64_t state = cfg.seed + (uint64_t)i;
+        game.NewGame(SplitMix64(state));
+        if (cfg.noGuessTries > 0) {
+            if (GenerateNoGuess(cfg, generator, spec, row, col, game.GetSeed(), layout, out)) game.SetMines(layout);
+            else game.PlaceMines(row, col);
+        } else {
+            game.PlaceMines(row, col);
+        }
+        sizes.clear();
+        BoardStats stats = analyzer.Analyze(game.grid, &sizes);
+        out.bbbv.Add(stats.bbbv);
+        out.openings.Add(stats.openings);
+        out.isolated.Add(stats.isolated);
+        out.largestOpening.Add(stats.largestOpening);
+        for (int n : sizes) out.openingSizes.Add(n);
+    }
+}
+
+// Plays recorded games back as fast as they go, each file cfg.passes times.
+static int RunReplays(const SimConfig& cfg) {
+    long long passes = cfg.passes;
+    std::vector<MoveLog> logs(cfg.replays.size());
+    for (size_t i = 0; i < logs.size(); i++) {
+        if (!logs[i].Load(cfg.replays[i])) { fprintf(stderr, "cannot read replay '%s'\n", cfg.replays[i].c_str()); return 1; }
+    }
+
+    Game game;
+    long long wins = 0, losses = 0, moves = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (long long p = 0; p < passes; p++) {
+        for (const MoveLog& log : logs) {
+            game.Replay(log);
+            moves += (long long)log.Moves();
+            if (p == 0) {
+                wins += game.victory;
+                losses += game.gameOver;
+            }
+        }
+    }
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    long long games = passes * (long long)logs.size();
+
+    printf("replays=%zu passes=%lld won=%lld lost=%lld unfinished=%lld\n", logs.size(), passes, wins, losses, (long long)logs.size() - wins - losses);
+    printf("games/sec: %.1f\n", (double)games / elapsed);
+    printf("moves/sec: %.1f\n", (double)moves / elapsed);
+    return 0;
+}
+
+static int RunAnalysis(SimConfig& cfg) {
+    if (cfg.threads <= 0) cfg.threads = std::max(1u, std::thread::hardware_concurrency());
+    if (cfg.seed == 0) cfg.seed = RandomSeed();
+
+    std::atomic<long long> next(0);
+    std::vector<WorkerResult> results(cfg.threads);
+    std::vector<std::thread> workers;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int t = 0; t < cfg.threads; t++) {
+        workers.emplace_back(RunAnalyzeWorker, std::cref(cfg), t, std::ref(next), std::ref(results[t]));
+    }
+    for (std::thread& w : workers) w.join();
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    WorkerResult total;
+    for (const WorkerResult& r : results) {
+        total.noGuessRetries += r.noGuessRetries;
+        total.noGuessFailed += r.noGuessFailed;
+        total.bbbv.Merge(r.bbbv);
+        total.openings.Merge(r.openings);
+        total.isolated.Merge(r.isolated);
+        total.openingSizes.Merge(r.openingSizes);
+        total.largestOpening.Merge(r.largestOpening);
+    }
+
+    printf("analyze board=%dx%d mines=%d boards=%lld threads=%d seed=%llu\n",
+           cfg.rows, cfg.cols, cfg.mines, cfg.games, cfg.threads, (unsigned long long)cfg.seed);
+    printf("boards/sec: %.1f (%.1f Mcells/sec)\n", (double)cfg.games / elapsed,
+           (double)cfg.games * cfg.rows * cfg.cols / elapsed / 1e6);
+    if (cfg.noGuessTries > 0) PrintNoGuess(cfg, total);
+    printf("\n");
+    total.bbbv.Print(stdout, "3BV");
+    total.openings.Print(stdout, "openings");
+    total.isolated.Print(stdout, "isolated numbers");
+    total.largestOpening.Print(stdout, "largest opening");
+    total.openingSizes.Print(stdout, "opening size");
+    return 0;
+}
+
+static double Percentile(const std::vector<double>& sorted, double p) {
+    if (sorted.empty()) return 0.0;
+    size_t i = (size_t)(p * (double)(sorted.size() - 1) + 0.5);
+    return sorted[std::min(i, sorted.size() - 1)];
+}
+
+int main(int argc, char** argv) {
+    SimConfig cfg;
+    if (!ParseArgs(argc, argv, cfg)) { Usage(); return 1; }
+    if (cfg.noGuessTries > 0 && !NoGuessFeasible(BoardSpec{ cfg.rows, cfg.cols, cfg.mines })) {
+        fprintf(stderr, "--noguess needs at most %d%% mines; %d on %dx%d is too dense\n", NOGUESS_MAX_DENSITY_PERCENT,
+                cfg.mines, cfg.rows, cfg.cols);
+        return 1;
+    }
+    if (!cfg.replays.empty()) return RunReplays(cfg);
+    if (cfg.analyze) return RunAnalysis(cfg);
+    std::unique_ptr<Bot> probe = MakeBot(cfg.bot, 0);
+    if (!probe) { fprintf(stderr, "unknown bot '%s'\n", cfg.bot.c_str()); return 1; }
+    bool fixed = cfg.board == "fixed";
+    if (!fixed && cfg.board != "dynamic") { fprintf(stderr, "unknown board '%s'\n", cfg.board.c_str()); return 1; }
+    if (fixed && (!probe->PlaysMinefield() || cfg.noGuessTries > 0 || !cfg.saveDir.empty())) {
+        fprintf(stderr, "--board fixed needs the random or simple bot and no --noguess or --save-replays\n");
+        return 1;
+    }
+    if (cfg.threads <= 0) cfg.threads = std::max(1u, std::thread::hardware_concurrency());
+    if (cfg.seed == 0) cfg.seed = RandomSeed();
+
+    std::atomic<long long> next(0);
+    std::vector<WorkerResult> results(cfg.threads);
+    std::vector<std::thread> workers;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int t = 0; t < cfg.threads; t++) {
+        workers.emplace_back(fixed ? RunBoardWorker : RunWorker, std::cref(cfg), t, std::ref(next), std::ref(results[t]));
+    }
+    for (std::thread& w : workers) w.join();
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    WorkerResult total;
+    std::vector<double> latencies;
+    latencies.reserve((size_t)cfg.games);
+    for (const WorkerResult& r : results) {
+        total.wins += r.wins;
+        total.noGuessRetries += r.noGuessRetries;
+        total.noGuessFailed += r.noGuessFailed;
+        latencies.insert(latencies.end(), r.latencies.begin(), r.latencies.end());
+    }
+    std::sort(latencies.begin(), latencies.end());
+
+    printf("bot=%s board=%dx%d%s mines=%d games=%lld threads=%d seed=%llu\n",
+           cfg.bot.c_str(), cfg.rows, cfg.cols, fixed ? " (fixed)" : "", cfg.mines, cfg.games, cfg.threads, (unsigned long long)cfg.seed);
+    printf("games/sec: %.1f\n", (double)cfg.games / elapsed);
+    printf("win rate:  %.2f%%\n", 100.0 * (double)total.wins / (double)cfg.games);
+    if (cfg.noGuessTries > 0) PrintNoGuess(cfg, total);
+    printf("latency per game (us): p50=%.1f p90=%.1f p99=%.1f max=%.1f\n",
+           Percentile(latencies, 0.50), Percentile(latencies, 0.90),
+           Percentile(latencies, 0.99), latencies.back());
+    return 0;
+}
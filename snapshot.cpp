@@ -0,0 +1,372 @@
+#include "snapshot.h"
+#include <climits>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static const char MAGIC[4] = { 'M', 'S', 'S', 'V' };
+static const uint8_t VERSION = 1;
+static const uint8_t FLAG_RLE = 1;
+static const size_t HEADER_SIZE = 4 + 1 + 1 + 4 + 4 + 4 + 8 + 4 + 4 + 4 + 1 + 4 + 4;
+
+enum : uint8_t {
+    BIT_FIRST_CLICK = 1,
+    BIT_MINES_PLACED = 2,
+    BIT_GAME_OVER = 4,
+    BIT_VICTORY = 8
+};
+
+static void Put(std::vector<uint8_t>& out, uint64_t v, int bytes) {
+    for (int i = 0; i < bytes; i++) out.push_back((uint8_t)(v >> (8 * i)));
+}
+
+static uint64_t Get(const uint8_t* p, int bytes) {
+    uint64_t v = 0;
+    for (int i = 0; i < bytes; i++) v |= (uint64_t)p[i] << (8 * i);
+    return v;
+}
+
+static void PutVarint(std::vector<uint8_t>& out, uint64_t v) {
+    while (v >= 0x80) {
+        out.push_back((uint8_t)(v | 0x80));
+        v >>= 7;
+    }
+    out.push_back((uint8_t)v);
+}
+
+static bool GetVarint(const uint8_t* data, size_t size, size_t& pos, uint64_t& v) {
+    v = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (pos >= size) return false;
+        uint8_t b = data[pos++];
+        v |= (uint64_t)(b & 0x7F) << shift;
+        if (!(b & 0x80)) return true;
+    }
+    return false;
+}
+
+// Runs of at least MIN_RUN equal bytes become varint(n << 1 | 1) and the byte;
+// everything between them is copied as varint(n << 1) and the bytes.
+static const size_t MIN_RUN = 4;
+
+static void EncodeRle(const std::vector<uint8_t>& in, std::vector<uint8_t>& out) {
+    size_t literal = 0, i = 0, n = in.size();
+    while (i < n) {
+        size_t j = i + 1;
+        while (j < n && in[j] == in[i]) j++;
+        if (j - i < MIN_RUN) {
+            i = j;
+            continue;
+        }
+        if (literal < i) {
+            PutVarint(out, (uint64_t)(i - literal) << 1);
+            out.insert(out.end(), in.begin() + literal, in.begin() + i);
+        }
+        PutVarint(out, (uint64_t)(j - i) << 1 | 1);
+        out.push_back(in[i]);
+        i = literal = j;
+    }
+    if (literal < n) {
+        PutVarint(out, (uint64_t)(n - literal) << 1);
+        out.insert(out.end(), in.begin() + literal, in.end());
+    }
+}
+
+static bool DecodeRle(const uint8_t* data, size_t size, uint8_t* out, size_t outSize) {
+    size_t pos = 0, o = 0;
+    while (pos < size) {
+        uint64_t v;
+        if (!GetVarint(data, size, pos, v)) return false;
+        uint64_t n = v >> 1;
+        if (n > outSize - o) return false;
+        if (v & 1) {
+            if (pos >= size) return false;
+            memset(out + o, data[pos++], (size_t)n);
+        }
+        else {
+            if (n > size - pos) return false;
+            memcpy(out + o, data + pos, (size_t)n);
+            pos += (size_t)n;
+        }
+        o += (size_t)n;
+    }
+    return o == outSize;
+}
+
+// Mine rows hold one bit per cell, least significant bit first, the same
+// order as a Bitboard word; state rows hold two bits per cell.
+static size_t MineRowBytes(int cols) { return ((size_t)cols + 7) / 8; }
+static size_t StateRowBytes(int cols) { return ((size_t)cols + 3) / 4; }
+
+static void PutLayer(std::vector<uint8_t>& out, const std::vector<uint8_t>& layer, bool compress) {
+    if (!compress) {
+        Put(out, layer.size(), 8);
+        out.insert(out.end(), layer.begin(), layer.end());
+        return;
+    }
+    std::vector<uint8_t> packed;
+    EncodeRle(layer, packed);
+    Put(out, packed.size(), 8);
+    out.insert(out.end(), packed.begin(), packed.end());
+}
+
+// Points data at the next section and advances pos past it.
+static bool GetSection(const uint8_t* data, size_t size, size_t& pos, const uint8_t*& section, size_t& length) {
+    if (size - pos < 8) return false;
+    uint64_t n = Get(data + pos, 8);
+    pos += 8;
+    if (n > size - pos) return false;
+    section = data + pos;
+    length = (size_t)n;
+    pos += length;
+    return true;
+}
+
+// Four cells of a state byte expanded to their grid bits, one per byte.
+struct StateTable {
+    uint32_t expand[256];
+
+    StateTable() {
+        for (int b = 0; b < 256; b++) {
+            uint32_t v = 0;
+            for (int k = 0; k < 4; k++) v |= (uint32_t)(((b >> (2 * k)) & 3) << Grid::STATE_SHIFT) << (8 * k);
+            expand[b] = v;
+        }
+    }
+};
+
+// Whether the runs in data add up to exactly outSize bytes, checked before
+// anything that size is allocated for them.
+static bool RleFits(const uint8_t* data, size_t size, size_t outSize) {
+    size_t pos = 0, o = 0;
+    while (pos < size) {
+        uint64_t v;
+        if (!GetVarint(data, size, pos, v)) return false;
+        uint64_t n = v >> 1;
+        if (n > outSize - o) return false;
+        size_t skip = (v & 1) ? 1 : (size_t)n;
+        if (skip > size - pos) return false;
+        pos += skip;
+        o += (size_t)n;
+    }
+    return o == outSize;
+}
+
+static bool GetLayer(const uint8_t* section, size_t length, bool compressed, std::vector<uint8_t>& scratch, size_t expected, const uint8_t*& layer) {
+    if (!compressed) {
+        layer = section;
+        return length == expected;
+    }
+    if (!RleFits(section, length, expected)) return false;
+    scratch.resize(expected);
+    layer = scratch.data();
+    return DecodeRle(section, length, scratch.data(), expected);
+}
+
+void WriteSnapshot(const Game& game, std::vector<uint8_t>& out, bool compress) {
+    int rows = game.rows, cols = game.cols;
+    const Grid& grid = game.grid;
+
+    out.assign(MAGIC, MAGIC + 4);
+    out.push_back(VERSION);
+    out.push_back(compress ? FLAG_RLE : 0);
+    Put(out, (uint32_t)rows, 4);
+    Put(out, (uint32_t)cols, 4);
+    Put(out, (uint32_t)game.mineCount, 4);
+    Put(out, game.seed, 8);
+    Put(out, (uint32_t)game.flagsLeft, 4);
+    Put(out, (uint32_t)game.revealedCnt, 4);
+    float timer = (float)game.clock.Seconds(GameClock::Clock::now());
+    uint32_t timerBits;
+    memcpy(&timerBits, &timer, 4);
+    Put(out, timerBits, 4);
+    out.push_back((uint8_t)((game.firstClick ? BIT_FIRST_CLICK : 0) | (game.minesPlaced ? BIT_MINES_PLACED : 0) |
+                            (game.gameOver ? BIT_GAME_OVER : 0) | (game.victory ? BIT_VICTORY : 0)));
+    Put(out, (uint32_t)game.explodedRow, 4);
+    Put(out, (uint32_t)game.explodedCol, 4);
+
+    size_t mineRow = MineRowBytes(cols), stateRow = StateRowBytes(cols);
+    std::vector<uint8_t> layer(mineRow * rows);
+    for (int r = 0; r < rows; r++) {
+        const uint8_t* cell = grid.Data() + grid.Index(r, 0);
+        uint8_t* dst = layer.data() + r * mineRow;
+        for (int c = 0; c < cols; c++) dst[c >> 3] |= (uint8_t)((cell[c] & Grid::MINE_BIT) << (c & 7));
+    }
+    PutLayer(out, layer, compress);
+
+    layer.assign(stateRow * rows, 0);
+    for (int r = 0; r < rows; r++) {
+        const uint8_t* cell = grid.Data() + grid.Index(r, 0);
+        uint8_t* dst = layer.data() + r * stateRow;
+        for (int c = 0; c < cols; c++) dst[c >> 2] |= (uint8_t)(((cell[c] & Grid::STATE_MASK) >> Grid::STATE_SHIFT) << (2 * (c & 3)));
+    }
+    PutLayer(out, layer, compress);
+
+    std::vector<uint8_t> record;
+    game.log.Serialize(record);
+    Put(out, record.size(), 8);
+    out.insert(out.end(), record.begin(), record.end());
+}
+
+bool ReadSnapshot(Game& game, const uint8_t* data, size_t size) {
+    if (size < HEADER_SIZE || memcmp(data, MAGIC, 4) != 0 || data[4] != VERSION) return false;
+    bool compressed = (data[5] & FLAG_RLE) != 0;
+    const uint8_t* p = data + 6;
+    uint64_t rows = Get(p, 4), cols = Get(p + 4, 4), mines = Get(p + 8, 4);
+    // Grid indexes cells, border included, with int.
+    if (rows == 0 || cols == 0 || rows > INT_MAX || cols > INT_MAX || (rows + 2) * (cols + 2) > (uint64_t)INT_MAX ||
+        mines > rows * cols) return false;
+
+    size_t pos = HEADER_SIZE;
+    size_t mineRow = MineRowBytes((int)cols), stateRow = StateRowBytes((int)cols);
+    const uint8_t *mineSection, *stateSection, *recordSection, *mineLayer, *stateLayer;
+    size_t mineLength, stateLength, recordLength;
+    std::vector<uint8_t> mineScratch, stateScratch;
+    if (!GetSection(data, size, pos, mineSection, mineLength) || !GetSection(data, size, pos, stateSection, stateLength) ||
+        !GetSection(data, size, pos, recordSection, recordLength) || pos != size) return false;
+    if (!GetLayer(mineSection, mineLength, compressed, mineScratch, mineRow * rows, mineLayer) ||
+        !GetLayer(stateSection, stateLength, compressed, stateScratch, stateRow * rows, stateLayer)) return false;
+
+    MoveLog record;
+    if (!record.Deserialize(recordSection, recordLength)) return false;
+    if ((uint64_t)record.rows != rows || (uint64_t)record.cols != cols || (uint64_t)record.mines != mines) return false;
+
+    // Decoded into a fresh game, so a snapshot rejected halfway leaves the
+    // caller's untouched. Init sets up the seeder and clears everything the
+    // snapshot does not hold; the caller's settings carry over.
+    Game loaded;
+    loaded.profiler = game.profiler;
+    loaded.trackDirty = game.trackDirty;
+    loaded.threads = game.threads;
+    loaded.Init((int)rows, (int)cols, (int)mines, Get(p + 12, 8));
+    int r0 = (int)rows, c0 = (int)cols;
+
+    for (int r = 0; r < r0; r++) {
+        uint64_t* words = loaded.mineBits.RowWords(r);
+        const uint8_t* src = mineLayer + r * mineRow;
+        for (size_t b = 0; b < mineRow; b++) words[b >> 3] |= (uint64_t)src[b] << (8 * (b & 7));
+        // Bits past the last column would otherwise turn into phantom mines.
+        if (c0 & 63) words[(c0 - 1) >> 6] &= ~0ULL >> (64 - (c0 & 63));
+    }
+    loaded.grid.LoadMines(loaded.mineBits);
+    loaded.CalculateNumbers();
+
+    if (loaded.mineBits.Count() != ((p[32] & BIT_MINES_PLACED) ? (long long)mines : 0)) return false;
+
+    static const StateTable table;
+    static const uint8_t REVEALED_SAFE = (uint8_t)((int)CellState::Revealed << Grid::STATE_SHIFT);
+    static const uint8_t FLAGGED_SAFE = (uint8_t)((int)CellState::Flagged << Grid::STATE_SHIFT);
+    static const uint8_t FLAGGED_MINE = FLAGGED_SAFE | Grid::MINE_BIT;
+    Grid& grid = loaded.grid;
+    uint64_t revealedCnt = (uint32_t)Get(p + 24, 4);
+    if (revealedCnt > rows * cols) return false;
+    // Rebuilds revealLog and the counters CountFlags would, in the same
+    // pass. Branch-free, since revealed and hidden cells interleave randomly;
+    // the log has room for a group of four writes past the last revealed cell.
+    loaded.revealLog.resize((size_t)revealedCnt + 4);
+    int* logOut = loaded.revealLog.data();
+    size_t logged = 0;
+    int flaggedMines = 0, wrongFlags = 0;
+    for (int r = 0; r < r0; r++) {
+        int idx = grid.Index(r, 0);
+        uint8_t* cell = grid.Data() + idx;
+        const uint8_t* src = stateLayer + r * stateRow;
+        for (int c = 0; c < c0; c += 4) {
+            uint32_t states = table.expand[src[c >> 2]];
+            if (!states) continue; // four hidden cells
+            int n = c0 - c < 4 ? c0 - c : 4;
+            for (int k = 0; k < n; k++, states >>= 8) {
+                uint8_t v = (uint8_t)(cell[c + k] | states);
+                cell[c + k] = v;
+                uint8_t kind = v & (Grid::STATE_MASK | Grid::MINE_BIT);
+                logOut[logged] = idx + c + k;
+                logged += kind == REVEALED_SAFE;
+                wrongFlags += kind == FLAGGED_SAFE;
+                flaggedMines += kind == FLAGGED_MINE;
+            }
+            if (logged > revealedCnt) return false;
+        }
+    }
+    if (logged != revealedCnt) return false;
+    loaded.revealLog.resize(logged);
+    loaded.flaggedMines = flaggedMines;
+    loaded.wrongFlags = wrongFlags;
+
+    loaded.flagsLeft = (int)(int32_t)Get(p + 20, 4);
+    loaded.revealedCnt = (int)revealedCnt;
+    uint32_t timerBits = (uint32_t)Get(p + 28, 4);
+    float timer;
+    memcpy(&timer, &timerBits, 4);
+    loaded.clock.Reset(timer);
+    uint8_t bits = p[32];
+    loaded.firstClick = (bits & BIT_FIRST_CLICK) != 0;
+    loaded.minesPlaced = (bits & BIT_MINES_PLACED) != 0;
+    loaded.gameOver = (bits & BIT_GAME_OVER) != 0;
+    loaded.victory = (bits & BIT_VICTORY) != 0;
+    loaded.explodedRow = (int)(int32_t)Get(p + 33, 4);
+    loaded.explodedCol = (int)(int32_t)Get(p + 37, 4);
+    loaded.log = std::move(record);
+    loaded.allDirty = true;
+    game = std::move(loaded);
+    return true;
+}
+
+bool SaveSnapshot(const Game& game, const std::string& path, bool compress) {
+    std::vector<uint8_t> bytes;
+    WriteSnapshot(game, bytes, compress);
+    FILE* f = fopen(path.c_str(), "wb");
+    if (!f) return false;
+    bool ok = fwrite(bytes.data(), 1, bytes.size(), f) == bytes.size();
+    return fclose(f) == 0 && ok;
+}
+
+#ifdef _WIN32
+bool LoadSnapshot(Game& game, const std::string& path) {
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    LARGE_INTEGER size;
+    bool ok = false;
+    if (GetFileSizeEx(file, &size) && size.QuadPart > 0) {
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping) {
+            const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            if (view) {
+                ok = ReadSnapshot(game, (const uint8_t*)view, (size_t)size.QuadPart);
+                UnmapViewOfFile(view);
+            }
+            CloseHandle(mapping);
+        }
+    }
+    CloseHandle(file);
+    return ok;
+}
+#else
+bool LoadSnapshot(Game& game, const std::string& path) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    bool ok = false;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        size_t size = (size_t)st.st_size;
+        void* view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (view != MAP_FAILED) {
+            madvise(view, size, MADV_SEQUENTIAL);
+            ok = ReadSnapshot(game, (const uint8_t*)view, size);
+            munmap(view, size);
+        }
+    }
+    close(fd);
+    return ok;
+}
+#endif
@@ -0,0 +1,33 @@
+#pragma once
+#include "game.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Saved games. A snapshot holds the board parameters, the counters and
+// flags of Game, and two bit-packed cell layers: one bit per cell for
+// mines and two bits per cell for CellState, each row starting on a byte.
+// Adjacent counts are not stored; ComputeAdjacency rebuilds them on load.
+// With compress set, each layer is run-length encoded, which shrinks the
+// long runs of hidden and revealed cells to a few bytes.
+//
+// Format, little endian:
+//   "MSSV", u8 version, u8 flags (bit 0: RLE layers)
+//   u32 rows, u32 cols, u32 mines, u64 seed
+//   i32 flagsLeft, i32 revealedCnt, f32 timer
+//   u8 state bits (firstClick, minesPlaced, gameOver, victory)
+//   i32 explodedRow, i32 explodedCol
+//   mine layer, state layer, move log; each as u64 byte count + bytes
+//
+// The undo history is not saved; the move log is, so a resumed game can
+// still be replayed from the start. A loaded game's clock is stopped at the
+// saved time; Game::SyncClock starts it again.
+void WriteSnapshot(const Game& game, std::vector<uint8_t>& out, bool compress = true);
+// False, with game left as it was, if data is not a whole, consistent
+// snapshot. game keeps its profiler, trackDirty and threads settings.
+bool ReadSnapshot(Game& game, const uint8_t* data, size_t size);
+
+bool SaveSnapshot(const Game& game, const std::string& path, bool compress = true);
+// Maps the file rather than reading it, so the layers are decoded straight
+// from the page cache.
+bool LoadSnapshot(Game& game, const std::string& path);
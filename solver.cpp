@@ -0,0 +1,176 @@
+#include "solver.h"
+#include <cstring>
+
+const uint8_t Solver::UNKNOWN;
+const uint8_t Solver::SAFE;
+const uint8_t Solver::MINE;
+
+static uint64_t Translate(uint64_t m, int shift) {
+    return shift >= 0 ? m << shift : m >> -shift;
+}
+
+void Solver::Reset(const Game& game) {
+    const Grid& grid = game.grid;
+    rows = grid.Rows();
+    cols = grid.Cols();
+    stride = grid.Stride();
+
+    int k = 0, j = 0;
+    for (int dr = -2; dr <= 2; dr++) {
+        for (int dc = -2; dc <= 2; dc++) {
+            if (dr == 0 && dc == 0) continue;
+            if (dr >= -1 && dr <= 1 && dc >= -1 && dc <= 1) {
+                nb[k] = dr * stride + dc;
+                nbBit[k++] = 1ULL << ((dr + 3) * 8 + dc + 3);
+            }
+            near[j] = dr * stride + dc;
+            nearShift[j++] = dr * 8 + dc;
+        }
+    }
+
+    size_t size = (size_t)grid.PaddedSize();
+    // Border cells are revealed from the start and never hold a mine.
+    known.assign(size, SAFE);
+    for (int i = 0; i < rows; i++) {
+        int idx = grid.Index(i, 0);
+        memset(&known[idx], UNKNOWN, cols);
+    }
+    mask.assign(size, 0);
+    need.assign(size, 0);
+    queued.assign(size, 0);
+    queue.clear();
+    safeCells.clear();
+    mineCells.clear();
+    safeNext = mineNext = 0;
+    seed = game.GetSeed();
+    undoCount = game.undoCount;
+    logNext = 0;
+    Sync(game);
+}
+
+void Solver::Sync(const Game& game) {
+    const Grid& grid = game.grid;
+    const std::vector<int>& log = game.revealLog;
+    if (grid.Rows() != rows || grid.Cols() != cols || game.GetSeed() != seed || log.size() < logNext ||
+        game.undoCount != undoCount) {
+        Reset(game);
+        return;
+    }
+    if (logNext == log.size()) return;
+    for (; logNext < log.size(); logNext++) {
+        int idx = log[logNext];
+        Open(idx, grid.Adjacent(idx));
+    }
+    Propagate();
+}
+
+void Solver::Push(int idx) {
+    if (queued[idx]) return;
+    queued[idx] = 1;
+    queue.push_back(idx);
+}
+
+// A newly revealed number: it is no longer unknown to the numbers around it,
+// and it becomes a constraint over its own unknown neighbors.
+void Solver::Open(int idx, int adjacent) {
+    if (known[idx] == UNKNOWN) {
+        known[idx] = SAFE;
+        for (int d = 0; d < 8; d++) {
+            int c = idx + nb[d];
+            if (mask[c] & nbBit[7 - d]) {
+                mask[c] &= ~nbBit[7 - d];
+                Push(c);
+            }
+        }
+    }
+    uint64_t m = 0;
+    int n = adjacent;
+    for (int d = 0; d < 8; d++) {
+        uint8_t k = known[idx + nb[d]];
+        if (k == UNKNOWN) m |= nbBit[d];
+        else if (k == MINE) n--;
+    }
+    mask[idx] = m;
+    need[idx] = (int8_t)n;
+    if (m) Push(idx);
+}
+
+void Solver::Deduce(int idx, uint8_t what) {
+    if (known[idx] != UNKNOWN) return;
+    known[idx] = what;
+    (what == SAFE ? safeCells : mineCells).push_back(idx);
+    for (int d = 0; d < 8; d++) {
+        int c = idx + nb[d];
+        if (mask[c] & nbBit[7 - d]) {
+            mask[c] &= ~nbBit[7 - d];
+            if (what == MINE) need[c]--;
+            Push(c);
+        }
+    }
+}
+
+void Solver::DeduceMask(int center, uint64_t m, uint8_t what) {
+    while (m) {
+        int b = LowestBit(m);
+        Deduce(center + ((b >> 3) - 3) * stride + (b & 7) - 3, what);
+        m &= m - 1;
+    }
+}
+
+void Solver::Propagate() {
+    int size = (int)mask.size();
+    while (!queue.empty()) {
+        int c = queue.back();
+        queue.pop_back();
+        queued[c] = 0;
+
+        uint64_t m = mask[c];
+        if (!m) continue;
+        int n = need[c];
+        if (n == 0) { DeduceMask(c, m, SAFE); continue; }
+        if (n == PopCount(m)) { DeduceMask(c, m, MINE); continue; }
+
+        for (int j = 0; j < 24; j++) {
+            int o = c + near[j];
+            if (o < 0 || o >= size || !mask[o]) continue;
+            uint64_t other = Translate(mask[o], nearShift[j]);
+            if (!(m & other)) continue;
+            uint64_t onlyC = m & ~other;
+            uint64_t onlyO = other & ~m;
+            int diff = n - need[o];
+            if (diff == PopCount(onlyC)) {
+                DeduceMask(c, onlyC, MINE);
+                DeduceMask(c, onlyO, SAFE);
+            }
+            else if (-diff == PopCount(onlyO)) {
+                DeduceMask(c, onlyO, MINE);
+                DeduceMask(c, onlyC, SAFE);
+            }
+            // A deduction touching our own set has queued us again.
+            if (mask[c] != m) break;
+        }
+    }
+}
+
+bool Solver::Hint(const Game& game, int& row, int& col, bool& mine) {
+    if (game.gameOver || game.victory || game.firstClick) return false;
+    Sync(game);
+    const Grid& grid = game.grid;
+    for (; safeNext < safeCells.size(); safeNext++) {
+        int idx = safeCells[safeNext];
+        if (grid.State(idx) == CellState::Revealed) continue;
+        row = grid.RowOf(idx);
+        col = grid.ColOf(idx);
+        mine = false;
+        return true;
+    }
+    for (; mineNext < mineCells.size(); mineNext++) {
+        int idx = mineCells[mineNext];
+        if (grid.State(idx) == CellState::Flagged) continue;
+        row = grid.RowOf(idx);
+        col = grid.ColOf(idx);
+        mine = true;
+        return true;
+    }
+    return false;
+}
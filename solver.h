@@ -0,0 +1,70 @@
+#pragma once
+#include "game.h"
+#include <cstdint>
+#include <vector>
+
+// Deduces safe cells and mines from the revealed numbers of a Game.
+//
+// Every revealed number with unresolved neighbors is a constraint: a set of
+// unknown cells holding a known number of mines. The set is a 64-bit mask
+// over an 8x8 window centred on the number (bit (dr + 3) * 8 + dc + 3), so
+// the mask of any number within two cells can be shifted into the same frame
+// and compared with a few and/andnot/popcount operations. Two rules run over
+// the frontier:
+//   - single cell: no mines left, or as many mines as unknown cells;
+//   - pairwise: if A needs |A \ B| more mines than B, then A \ B are all
+//     mines and B \ A all safe (this covers the subset rule).
+// Flags placed by the player are not trusted; only deduced mines count.
+//
+// Sync reads only the cells the game revealed since the previous call (from
+// Game::revealLog) and re-examines the constraints around them, so solving
+// along a game costs time in proportion to what changed, not to board size.
+class Solver {
+public:
+    static const uint8_t UNKNOWN = 0;
+    static const uint8_t SAFE = 1;
+    static const uint8_t MINE = 2;
+
+    // Starts over from the game's current board.
+    void Reset(const Game& game);
+    // Takes in cells revealed since the last Reset or Sync and propagates.
+    // A new seed, size, shorter log or an undo since the last call triggers
+    // a Reset; restarting with the same seed needs an explicit one.
+    void Sync(const Game& game);
+
+    // A deduced move still worth making: a hidden safe cell to reveal, or
+    // else a deduced mine that is not flagged yet. False if none is known.
+    bool Hint(const Game& game, int& row, int& col, bool& mine);
+
+    uint8_t Known(int idx) const { return known[idx]; }
+    const std::vector<int>& SafeCells() const { return safeCells; }
+    const std::vector<int>& MineCells() const { return mineCells; }
+
+private:
+    void Open(int idx, int adjacent);
+    void Deduce(int idx, uint8_t what);
+    void DeduceMask(int center, uint64_t mask, uint8_t what);
+    void Propagate();
+    void Push(int idx);
+
+    int rows = 0;
+    int cols = 0;
+    int stride = 0;
+    int nb[8] = { 0 };
+    int near[24] = { 0 };     // offsets of every cell within two, and
+    int nearShift[24] = { 0 }; // the shift from its window into ours
+    uint64_t nbBit[8] = { 0 };
+
+    uint64_t seed = 0;
+    size_t logNext = 0;          // first revealLog entry not taken in yet
+    uint64_t undoCount = 0;      // Game::undoCount when logNext was valid
+    std::vector<uint8_t> known;  // UNKNOWN, SAFE or MINE per padded index
+    std::vector<uint64_t> mask;  // unknown neighbors of each revealed number
+    std::vector<int8_t> need;    // mines among them
+    std::vector<uint8_t> queued;
+    std::vector<int> queue;
+    std::vector<int> safeCells;
+    std::vector<int> mineCells;
+    size_t safeNext = 0;
+    size_t mineNext = 0;
+};
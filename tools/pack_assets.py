@@ -0,0 +1,257 @@
+#!/usr/bin/env python3
+"""Packs the game's sprites and number glyphs into one RGBA atlas and writes
+it out as C++ source, so the game creates a single texture at startup
+without touching the filesystem:
+
+    tools/pack_assets.py [--graphics Graphics] [--out .]
+
+Writes assets.h (sprite ids and rectangles) and assets.cpp (the pixels).
+Both are committed; run this again after changing anything in Graphics/.
+Sprites are scaled down here to the size they are drawn at, so the game
+blits them 1:1. Needs only the standard library.
+"""
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+CELL_SIZE = 48
+# Cell sprites leave a 2 px margin; the face fills the HUD's FACE_SIZE box.
+CELL_SPRITE = CELL_SIZE - 4
+FACE_SIZE = 40
+ICON_SIZE = 64
+ATLAS_WIDTH = 256
+GLYPH_SCALE = 3
+
+# (name, file, size) in the order of the Sprite enum below; the digits
+# follow them.
+SPRITES = [
+    ("bomb", "bomb1.png", CELL_SPRITE),
+    ("exploded bomb", "bomb2.png", CELL_SPRITE),
+    ("flag", "flag1.png", CELL_SPRITE),
+    ("question mark", "question1.png", CELL_SPRITE),
+    ("face", "face01.png", FACE_SIZE),
+    ("worried face", "face02.png", FACE_SIZE),
+    ("lost face", "face03.png", FACE_SIZE),
+    ("won face", "face04.png", FACE_SIZE),
+    ("icon", "logo1.png", ICON_SIZE),
+]
+
+# Glyphs for the adjacency numbers 1-8, drawn white and tinted when used.
+DIGITS = [
+    ["..#..", ".##..", "..#..", "..#..", "..#..", "..#..", ".###."],
+    [".###.", "#...#", "....#", "...#.", "..#..", ".#...", "#####"],
+    ["#####", "...#.", "..#..", "...#.", "....#", "#...#", ".###."],
+    ["...#.", "..##.", ".#.#.", "#..#.", "#####", "...#.", "...#."],
+    ["#####", "#....", "####.", "....#", "....#", "#...#", ".###."],
+    ["..##.", ".#...", "#....", "####.", "#...#", "#...#", ".###."],
+    ["#####", "....#", "...#.", "..#..", ".#...", ".#...", ".#..."],
+    [".###.", "#...#", "#...#", ".###.", "#...#", "#...#", ".###."],
+]
+
+
+class Bitmap:
+    def __init__(self, width, height, pixels=None):
+        self.width = width
+        self.height = height
+        self.pixels = pixels if pixels is not None else bytearray(width * height * 4)
+
+
+def paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    if pa <= pb and pa <= pc:
+        return a
+    return b if pb <= pc else c
+
+
+def read_png(path):
+    """Decodes an 8-bit, non-interlaced RGB or RGBA PNG."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError("%s: not a PNG" % path)
+    pos, idat = 8, []
+    width = height = channels = None
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, color, _, _, interlace = struct.unpack(">IIBBBBB", body)
+            channels = {2: 3, 6: 4}.get(color)
+            if depth != 8 or channels is None or interlace:
+                raise ValueError("%s: only 8-bit non-interlaced RGB(A) is supported" % path)
+        elif kind == b"IDAT":
+            idat.append(body)
+        elif kind == b"IEND":
+            break
+    raw = zlib.decompress(b"".join(idat))
+    stride = width * channels
+    out = bytearray(width * height * 4)
+    prev = bytearray(stride)
+    for y in range(height):
+        kind = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - channels] if i >= channels else 0
+            c = prev[i - channels] if i >= channels else 0
+            if kind == 1:
+                line[i] = (line[i] + a) & 255
+            elif kind == 2:
+                line[i] = (line[i] + prev[i]) & 255
+            elif kind == 3:
+                line[i] = (line[i] + ((a + prev[i]) >> 1)) & 255
+            elif kind == 4:
+                line[i] = (line[i] + paeth(a, prev[i], c)) & 255
+        for x in range(width):
+            o = (y * width + x) * 4
+            out[o:o + channels] = line[x * channels:(x + 1) * channels]
+            if channels == 3:
+                out[o + 3] = 255
+        prev = line
+    return Bitmap(width, height, out)
+
+
+def resize(src, width, height):
+    """Area-averaged downscale with premultiplied alpha, so transparent
+    pixels do not bleed their colour into the edges."""
+    if (src.width, src.height) == (width, height):
+        return src
+    dst = Bitmap(width, height)
+    sx, sy = src.width / width, src.height / height
+    for y in range(height):
+        y0, y1 = y * sy, (y + 1) * sy
+        for x in range(width):
+            x0, x1 = x * sx, (x + 1) * sx
+            acc = [0.0, 0.0, 0.0, 0.0]
+            area = 0.0
+            for j in range(int(y0), min(int(y1 + 0.999999), src.height)):
+                wy = min(y1, j + 1) - max(y0, j)
+                for i in range(int(x0), min(int(x1 + 0.999999), src.width)):
+                    w = wy * (min(x1, i + 1) - max(x0, i))
+                    o = (j * src.width + i) * 4
+                    alpha = src.pixels[o + 3] * w
+                    acc[0] += src.pixels[o] * alpha
+                    acc[1] += src.pixels[o + 1] * alpha
+                    acc[2] += src.pixels[o + 2] * alpha
+                    acc[3] += alpha
+                    area += w
+            o = (y * width + x) * 4
+            if acc[3] > 0:
+                for k in range(3):
+                    dst.pixels[o + k] = min(255, int(acc[k] / acc[3] + 0.5))
+            dst.pixels[o + 3] = min(255, int(acc[3] / area + 0.5))
+    return dst
+
+
+def glyph(rows):
+    bmp = Bitmap(len(rows[0]) * GLYPH_SCALE, len(rows) * GLYPH_SCALE)
+    for y in range(bmp.height):
+        for x in range(bmp.width):
+            if rows[y // GLYPH_SCALE][x // GLYPH_SCALE] == "#":
+                o = (y * bmp.width + x) * 4
+                bmp.pixels[o:o + 4] = b"\xff\xff\xff\xff"
+    return bmp
+
+
+def pack(images):
+    """Shelf packing, tallest first, with a transparent pixel between
+    sprites. Returns the atlas height and each image's position."""
+    order = sorted(range(len(images)), key=lambda i: (-images[i].height, i))
+    places = [None] * len(images)
+    x = y = shelf = 0
+    for i in order:
+        img = images[i]
+        if x + img.width > ATLAS_WIDTH:
+            x, y, shelf = 0, y + shelf + 1, 0
+        places[i] = (x, y)
+        x += img.width + 1
+        shelf = max(shelf, img.height)
+    return y + shelf, places
+
+
+def write_if_changed(path, text):
+    if os.path.exists(path):
+        with open(path) as f:
+            if f.read() == text:
+                return
+    with open(path, "w") as f:
+        f.write(text)
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--graphics", default=os.path.join(os.path.dirname(__file__), "..", "Graphics"))
+    parser.add_argument("--out", default=os.path.join(os.path.dirname(__file__), ".."))
+    args = parser.parse_args()
+
+    names, images = [], []
+    for name, file, size in SPRITES:
+        names.append(name)
+        images.append(resize(read_png(os.path.join(args.graphics, file)), size, size))
+    for n, rows in enumerate(DIGITS):
+        names.append("digit %d" % (n + 1))
+        images.append(glyph(rows))
+
+    height, places = pack(images)
+    atlas = bytearray(ATLAS_WIDTH * height * 4)
+    for img, (px, py) in zip(images, places):
+        for y in range(img.height):
+            o = ((py + y) * ATLAS_WIDTH + px) * 4
+            atlas[o:o + img.width * 4] = img.pixels[y * img.width * 4:(y + 1) * img.width * 4]
+
+    header = """// Generated by tools/pack_assets.py from Graphics/; do not edit.
+#pragma once
+
+// Every sprite the game draws, packed into one RGBA atlas that is compiled
+// into the binary, so startup needs no file reads or image decoding.
+enum Sprite {
+    SPRITE_BOMB,
+    SPRITE_BOMB_EXPLODED,
+    SPRITE_FLAG,
+    SPRITE_QUESTION,
+    SPRITE_FACE,        // SPRITE_FACE + 0..3: playing, worried, lost, won
+    SPRITE_ICON = SPRITE_FACE + 4,
+    SPRITE_DIGIT,       // SPRITE_DIGIT + n - 1 for the number n, drawn white
+    SPRITE_COUNT = SPRITE_DIGIT + 8
+};
+
+struct SpriteRect {
+    short x, y, width, height;
+};
+
+const int ATLAS_WIDTH = %d;
+const int ATLAS_HEIGHT = %d;
+
+extern const SpriteRect SPRITES[SPRITE_COUNT];
+// ATLAS_WIDTH * ATLAS_HEIGHT pixels, 8-bit RGBA, top row first.
+extern const unsigned char ATLAS_PIXELS[];
+""" % (ATLAS_WIDTH, height)
+
+    rects = "\n".join("    { %d, %d, %d, %d },  // %s" % (px, py, img.width, img.height, name)
+                      for name, img, (px, py) in zip(names, images, places))
+    lines = []
+    for o in range(0, len(atlas), 32):
+        lines.append("    " + ",".join(str(b) for b in atlas[o:o + 32]) + ",")
+    source = """// Generated by tools/pack_assets.py from Graphics/; do not edit.
+#include "assets.h"
+
+const SpriteRect SPRITES[SPRITE_COUNT] = {
+%s
+};
+
+const unsigned char ATLAS_PIXELS[] = {
+%s
+};
+""" % (rects, "\n".join(lines))
+
+    write_if_changed(os.path.join(args.out, "assets.h"), header)
+    write_if_changed(os.path.join(args.out, "assets.cpp"), source)
+    print("packed %d sprites into a %dx%d atlas (%d KiB)" % (len(images), ATLAS_WIDTH, height, len(atlas) // 1024))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())